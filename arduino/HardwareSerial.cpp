@@ -39,8 +39,15 @@ struct ring_buffer
   unsigned char buffer[RX_BUFFER_SIZE];
   int head;
   int tail;
+  uint16_t *time; // arrival time of each character, or NULL
 };
 
+// Timestamp for received characters on ports defined with
+// SERIAL_DEFINE_TIMESTAMPED. The sketch can override this to stamp
+// characters against its own clock.
+uint16_t serialRxTime() __attribute__((weak));
+uint16_t serialRxTime() { return 0; }
+
 inline void store_char(unsigned char c, ring_buffer *rx_buffer)
 {
   int i = (unsigned int)(rx_buffer->head + 1) % RX_BUFFER_SIZE;
@@ -51,6 +58,9 @@ inline void store_char(unsigned char c, ring_buffer *rx_buffer)
   // and so we don't write the character or advance the head.
   if (i != rx_buffer->tail) {
     rx_buffer->buffer[rx_buffer->head] = c;
+    if (rx_buffer->time) {
+      rx_buffer->time[rx_buffer->head] = serialRxTime();
+    }
     rx_buffer->head = i;
   }
 }
@@ -69,6 +79,7 @@ HardwareSerial::HardwareSerial(
   this->_port      = port;
   this->_in_bm     = in_bm;
   this->_out_bm    = out_bm;
+  this->_read_time = 0;
 }
 
 // Public Methods //////////////////////////////////////////////////////////////
@@ -109,8 +120,11 @@ void HardwareSerial::begin(unsigned long baud)
   
   // enable Rx and Tx
   _usart->CTRLB |= USART_RXEN_bm | USART_TXEN_bm;
-  // enable interrupt
-  _usart->CTRLA = (_usart->CTRLA & ~USART_RXCINTLVL_gm) | USART_RXCINTLVL_LO_gc;
+  // Enable the interrupt at high level. The synthesizer renders audio in
+  // a medium level interrupt that can take most of a block, about 1ms,
+  // and the USART only holds two characters, so at a low level MIDI
+  // bytes (one every 320us) would be lost. store_char() is short.
+  _usart->CTRLA = (_usart->CTRLA & ~USART_RXCINTLVL_gm) | USART_RXCINTLVL_HI_gc;
 
   // Char size, parity and stop bits: 8N1
   _usart->CTRLC = USART_CHSIZE_8BIT_gc | USART_PMODE_DISABLED_gc;
@@ -153,6 +167,9 @@ int HardwareSerial::read(void)
     return -1;
   } else {
     unsigned char c = _rx_buffer->buffer[_rx_buffer->tail];
+    if (_rx_buffer->time) {
+      _read_time = _rx_buffer->time[_rx_buffer->tail];
+    }
     _rx_buffer->tail = (unsigned int)(_rx_buffer->tail + 1) % RX_BUFFER_SIZE;
     return c;
   }
@@ -192,6 +209,11 @@ void HardwareSerial::setIREnabled(bool enable)
 	}
 }
 
+uint16_t HardwareSerial::readTime()
+{
+  return _read_time;
+}
+
 HardwareSerial::operator bool() {
   return true;
 }
@@ -207,7 +229,17 @@ HardwareSerial Serial3 (&Serial3rx_buffer, &USARTD1, &PORTD, PIN6_bm, PIN7_bm);
 */
 
 #define SERIAL_DEFINE(name, usart_port, port_nr) \
-ring_buffer name##rx_buffer = { { 0 }, 0, 0 }; \
+ring_buffer name##rx_buffer = { { 0 }, 0, 0, NULL }; \
+SERIAL_DEFINE_PORT(name, usart_port, port_nr)
+
+// Same as SERIAL_DEFINE, and stamps each received character with
+// serialRxTime(), see HardwareSerial::readTime().
+#define SERIAL_DEFINE_TIMESTAMPED(name, usart_port, port_nr) \
+uint16_t name##rx_time[RX_BUFFER_SIZE]; \
+ring_buffer name##rx_buffer = { { 0 }, 0, 0, name##rx_time }; \
+SERIAL_DEFINE_PORT(name, usart_port, port_nr)
+
+#define SERIAL_DEFINE_PORT(name, usart_port, port_nr) \
 ISR(USART##usart_port##port_nr##_RXC_vect) \
 { \
   unsigned char c = USART##usart_port##port_nr.DATA; \
@@ -26,6 +26,8 @@
 
 struct ring_buffer;
 
+uint16_t serialRxTime();
+
 class HardwareSerial : public Stream
 {
   private:
@@ -34,6 +36,7 @@ class HardwareSerial : public Stream
     PORT_t      *_port;
     uint8_t     _in_bm;
     uint8_t     _out_bm;
+    uint16_t    _read_time;
   public:
     HardwareSerial(
         ring_buffer *rx_buffer,
@@ -55,6 +58,9 @@ class HardwareSerial : public Stream
     inline size_t write(int n) { return write((uint8_t)n); }
     using Print::write; // pull in write(str) and write(buf, size) from Print
     void setIREnabled(bool enabled);
+    // serialRxTime() of the last character returned by read(), on
+    // ports defined with SERIAL_DEFINE_TIMESTAMPED
+    uint16_t readTime();
     operator bool();
 };
 
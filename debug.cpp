@@ -87,15 +87,15 @@ void doDebug() {
         Serial.print(note[i].midiVal);
         Serial.print("  ");
 
-        Serial.print("f[");
+        Serial.print("pitch[");
         Serial.print(i);
         Serial.print("]=");
-        Serial.print(note[i].frequency);
+        Serial.print(note[i].pitch);
 
         Serial.print(" vol[");
         Serial.print(i);
         Serial.print("]=");
-        Serial.print(note[i].volume);
+        Serial.print(voiceVolume(i));
         Serial.print(" | ");
       }
       */
@@ -108,6 +108,22 @@ void doDebug() {
       }
 
 
+      for(byte k=0;k<N_KERNELS;k++) {
+	Serial.print(" kernel ");
+	Serial.print(k);
+	Serial.print(" cycles/sample = ");
+	Serial.print(kernelCycles[k]);
+	Serial.print(", filtered = ");
+	Serial.print(filteredKernelCycles[k]);
+      }
+      Serial.println("");
+
+      Serial.print(" output stage cycles/sample = ");
+      Serial.println(outputCycles);
+
+      Serial.print(" max note on latency (samples) = ");
+      Serial.println(maxNoteOnLatency);
+
       unsigned int remaining = TCC0.PER - counterEnd;
       if (remaining < 50) {
         Serial.print("WARNING: only ");
@@ -23,9 +23,13 @@
 #define EEPROM_MAGIC_NUMBER 0xbad0
 #define PATCH_VALID_MARK 0xe3ad
 #define SEQUENCE_VALID_MARK 0xf7da
+#define MOD_MATRIX_VALID_MARK 0xc51e
 #define PATCH_BASE_ADDR 5
 #define PATCH_SIZE 509
 #define NUM_PATCHES 4
+#define OUTPUT_RATE_ADDR 2041 // after the last patch
+#define HEADROOM_ADDR 2042
+#define GLOBAL_SETTINGS_SAVE_MS 2000
 
 byte readByte(uint16_t);
 uint16_t writeByte(uint16_t, byte);
@@ -40,6 +44,8 @@ void readGlobalSettings() {
   if (eepromValid()) {
     mode = readByte(2);
     tuningSetting = readWord(3);
+    setOutputRate(readByte(OUTPUT_RATE_ADDR));
+    setHeadroom(readByte(HEADROOM_ADDR));
 #ifdef DEBUG_ENABLE
     debugprintln("tuningSetting = ", tuningSetting);
 #endif
@@ -50,11 +56,33 @@ void writeGlobalSettings() {
   eepromSetValid();
 
   cli();
+  holdAudio();
   writeByte(2, mode);
   writeWord(3, tuningSetting);
+  writeByte(OUTPUT_RATE_ADDR, outputRateSetting);
+  writeByte(HEADROOM_ADDR, headroomSetting);
   sei();
 }
 
+// Global settings changed by MIDI controllers are written once they have
+// stayed the same for GLOBAL_SETTINGS_SAVE_MS, so sweeping a controller
+// does not write the EEPROM, with the audio held, for every value.
+boolean globalSettingsChangedFlag = false;
+unsigned long globalSettingsChangeTime;
+
+void globalSettingsChanged() {
+  globalSettingsChangedFlag = true;
+  globalSettingsChangeTime = millis();
+}
+
+// Called from loop()
+void saveChangedGlobalSettings() {
+  if ((globalSettingsChangedFlag) && (millis() - globalSettingsChangeTime >= GLOBAL_SETTINGS_SAVE_MS)) {
+    globalSettingsChangedFlag = false;
+    writeGlobalSettings();
+  }
+}
+
 boolean patchValid(byte i) {
   cli();
   uint16_t addr = PATCH_BASE_ADDR + (i * PATCH_SIZE);
@@ -75,6 +103,7 @@ void toggleLED(byte i) {
 void savePatch(byte p) {
   debugprintln("saving patch ", p);
   cli();
+  holdAudio();
   uint16_t addr = PATCH_BASE_ADDR + (p * PATCH_SIZE);
   uint16_t startAddr = addr;
   addr = writeWord(addr, PATCH_VALID_MARK);
@@ -86,14 +115,17 @@ void savePatch(byte p) {
     addr = writeWord(addr, sustain);
     toggleLED(p);
     addr = writeWord(addr, settings[i].releaseVolLevelDuration);
-    int16_t detune = (settings[i].detune * 1024);
+    // saved as it was when detune was a float in [-1.0, 1.0]
+    int16_t detune = settings[i].detune * 4;
     addr = writeWord(addr, detune);
-    addr = writeByte(addr, settings[i].waveform);
+    // the top bit of the waveform byte holds the interpolation setting
+    addr = writeByte(addr, settings[i].waveform | ((settings[i].interpolate) ? WAVEFORM_INTERPOLATE_BIT : 0));
   }
 
   toggleLED(p);
   addr = writeWord(addr, filterCutoff);
-  addr = writeWord(addr, filterResonance);
+  // the high byte of the resonance word holds the filter mode
+  addr = writeWord(addr, filterResonance | (filterMode << 8));
   addr = writeByte(addr, lfoWaveform);
 
   if (mode == MODE_GROOVEBOX) {
@@ -112,6 +144,15 @@ void savePatch(byte p) {
       }
     }
     
+  } else {
+    // The sequence of a groovebox patch fills it, so the modulation
+    // matrix is only saved in the other modes.
+    addr = writeWord(addr, MOD_MATRIX_VALID_MARK);
+    for(byte i=0;i<N_MOD_SLOTS;i++) {
+      addr = writeByte(addr, modSlot[i].source);
+      addr = writeByte(addr, modSlot[i].destination);
+      addr = writeByte(addr, modSlot[i].amount);
+    }
   }
   digitalWrite(led[p], LOW);
   debugprintln("size = ", addr-startAddr);
@@ -126,6 +167,7 @@ void loadPatch(byte p) {
   }
 
   cli();
+  holdAudio();
   uint16_t addr = PATCH_BASE_ADDR + (p * PATCH_SIZE);
   addr += 2;
   for(byte i=0;i<N_SETTINGS;i++) {
@@ -141,16 +183,24 @@ void loadPatch(byte p) {
     settings[i].releaseVolLevelDuration = readWord(addr);
     addr += sizeof(uint16_t);
     int16_t detune = readWord(addr);
-    settings[i].detune = (float)(detune / 1024.0);
+    settings[i].detune = detune / 4;
     addr += sizeof(uint16_t);
-    settings[i].waveform = readByte(addr);
+    byte waveform = readByte(addr);
+    settings[i].waveform = waveform & ~WAVEFORM_INTERPOLATE_BIT;
+    settings[i].interpolate = ((waveform & WAVEFORM_INTERPOLATE_BIT) != 0);
     addr += sizeof(uint8_t);
   }
 
   toggleLED(p);
   filterCutoff = readWord(addr);
   addr += sizeof(uint16_t);
-  filterResonance = readWord(addr);
+  uint16_t resonance = readWord(addr);
+  filterResonance = resonance & 0xFF;
+  filterMode = resonance >> 8;
+  if (filterMode >= N_FILTER_MODES) {
+    filterMode = FILTER_MODE_LEGACY;
+  }
+  setFilterFeedback();
   addr += sizeof(uint16_t);
   lfoWaveform = readByte(addr);
   lfoWaveformBuf = lfoWaveformBuffers[lfoWaveform];
@@ -184,6 +234,31 @@ void loadPatch(byte p) {
       debugprintln("valid sequence not found");
     }
   }
+
+  // Patches saved before the modulation matrix, and groovebox patches,
+  // load with an empty one.
+  boolean modMatrixValid = false;
+  if (mode != MODE_GROOVEBOX) {
+    modMatrixValid = (readWord(addr) == MOD_MATRIX_VALID_MARK);
+    addr += sizeof(uint16_t);
+  }
+  for(byte i=0;i<N_MOD_SLOTS;i++) {
+    modSlot_t *slot = &modSlot[i];
+    slot->source = MOD_SRC_NONE;
+    slot->destination = MOD_DST_PITCH;
+    slot->amount = 0;
+    if (modMatrixValid) {
+      byte source = readByte(addr);
+      byte destination = readByte(addr + 1);
+      if ((source < N_MOD_SOURCES) && (destination < N_MOD_DESTINATIONS)) {
+	slot->source = source;
+	slot->destination = destination;
+	slot->amount = readByte(addr + 2);
+      }
+      addr += 3;
+    }
+  }
+  setModRouting();
   digitalWrite(led[p], LOW);
 
   sei();
@@ -193,6 +268,7 @@ void loadPatch(byte p) {
 
 void eepromClear() {
   cli();
+  holdAudio();
   for(int i=0;i<2048;i++) {
     if ((i % 8) == 0) {
       toggleLED(0);
@@ -219,6 +295,7 @@ boolean eepromValid() {
   
 void eepromSetValid() {
   cli();
+  holdAudio();
   writeWord(0, EEPROM_MAGIC_NUMBER);
   sei();
 }
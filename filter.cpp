@@ -21,12 +21,80 @@
 // Filter parameters
 int filterCutoff;
 int filterResonance;
+int8_t filterResonanceMod = 0; // added to filterResonance by the modulation matrix
+byte filterMode = FILTER_MODE_LEGACY;
 long feedback;
-int buf0;
-int buf1;
+unsigned int svfF; // state variable filter frequency and damping, Q15
+unsigned int svfQ;
+filterState_t filterState[AUDIO_CHANNELS];
 
+// Frequency coefficient of the state variable filter for each cutoff,
+// 2 * sin(pi * fc / 25000) in Q15, with fc going from 30Hz up to about
+// 6KHz in equal steps of pitch.
+const uint16_t svfFrequency[256] PROGMEM = {
+  247, 252, 258, 263, 269, 274, 280, 286, 292, 298, 305, 311, 318, 324, 331, 338,
+  345, 353, 360, 368, 376, 383, 392, 400, 408, 417, 426, 435, 444, 453, 463, 473,
+  483, 493, 503, 514, 525, 536, 547, 559, 571, 583, 595, 608, 621, 634, 647, 661,
+  675, 689, 704, 718, 734, 749, 765, 781, 798, 815, 832, 849, 867, 886, 904, 924,
+  943, 963, 983, 1004, 1026, 1047, 1069, 1092, 1115, 1139, 1163, 1187, 1212, 1238, 1264, 1291,
+  1318, 1346, 1375, 1404, 1433, 1464, 1495, 1526, 1559, 1592, 1625, 1660, 1695, 1731, 1767, 1804,
+  1843, 1882, 1921, 1962, 2003, 2046, 2089, 2133, 2178, 2224, 2271, 2320, 2369, 2419, 2470, 2522,
+  2575, 2630, 2685, 2742, 2800, 2859, 2920, 2981, 3044, 3109, 3174, 3242, 3310, 3380, 3451, 3524,
+  3599, 3675, 3753, 3832, 3913, 3995, 4080, 4166, 4254, 4344, 4436, 4529, 4625, 4723, 4822, 4924,
+  5028, 5134, 5243, 5353, 5466, 5582, 5699, 5820, 5942, 6068, 6196, 6326, 6460, 6596, 6735, 6877,
+  7022, 7170, 7321, 7475, 7632, 7793, 7957, 8124, 8295, 8470, 8648, 8830, 9015, 9205, 9398, 9596,
+  9797, 10003, 10213, 10427, 10645, 10869, 11096, 11329, 11566, 11808, 12055, 12307, 12564, 12826, 13094, 13367,
+  13645, 13930, 14220, 14515, 14817, 15125, 15439, 15759, 16086, 16419, 16758, 17105, 17458, 17818, 18185, 18559,
+  18940, 19329, 19725, 20129, 20540, 20959, 21386, 21821, 22265, 22716, 23176, 23644, 24120, 24605, 25099, 25601,
+  26112, 26632, 27161, 27699, 28246, 28803, 29368, 29942, 30526, 31118, 31720, 32331, 32952, 33581, 34219, 34866,
+  35522, 36187, 36860, 37542, 38232, 38930, 39636, 40349, 41069, 41797, 42531, 43271, 44016, 44767, 45523, 46283
+};
 
+// Damping (1/Q) of the state variable filter for the top 6 bits of the
+// resonance, Q15. Q goes from 0.6 up to 18 in equal ratios.
+const uint16_t svfDamping[64] PROGMEM = {
+  54613, 51743, 49024, 46447, 44006, 41693, 39502, 37426, 35459, 33596, 31830, 30157, 28572, 27070, 25648, 24300,
+  23023, 21813, 20666, 19580, 18551, 17576, 16652, 15777, 14948, 14162, 13418, 12713, 12045, 11412, 10812, 10244,
+  9705, 9195, 8712, 8254, 7820, 7409, 7020, 6651, 6301, 5970, 5657, 5359, 5078, 4811, 4558, 4318,
+  4091, 3876, 3673, 3480, 3297, 3123, 2959, 2804, 2656, 2517, 2385, 2259, 2141, 2028, 1921, 1820
+};
+
+// Highest frequency coefficient that keeps the filter stable at each
+// damping: 95% of sqrt(q^2 + 4) - q, where f^2 + 2fq reaches 4. With
+// little resonance this holds the cutoff to about fs/7.
+const uint16_t svfFrequencyLimit[64] PROGMEM = {
+  29161, 30169, 31178, 32185, 33187, 34182, 35167, 36141, 37102, 38047, 38976, 39885, 40775, 41645, 42492, 43316,
+  44118, 44895, 45648, 46377, 47082, 47762, 48418, 49050, 49657, 50242, 50804, 51342, 51859, 52355, 52829, 53284,
+  53718, 54133, 54530, 54910, 55272, 55617, 55946, 56261, 56560, 56845, 57117, 57376, 57622, 57857, 58080, 58292,
+  58494, 58685, 58868, 59041, 59206, 59363, 59511, 59653, 59787, 59914, 60035, 60150, 60259, 60362, 60461, 60554
+};
+
+// Derive the coefficients the output ISR filters with from filterCutoff
+// and filterResonance, moved by the modulation matrix. The frequency
+// table is for 25KHz, and is scaled to the output rate by
+// envelopeRateScale (25KHz / outputRate), which is close for the
+// cutoffs that the stability limit lets through.
+//
+// The output ISR calls this every block while the cutoff is modulated,
+// and loop() and the MIDI handlers call it too. The whole update runs
+// with interrupts off, so a main loop call can't read a cutoff the ISR
+// is changing, or write coefficients from old settings over the ISR's.
 void setFilterFeedback() {
-  feedback = (long)filterResonance + (long)(((long)filterResonance * ((int)384 - (255-filterCutoff))) >> 8);
+  byte oldSREG = SREG;
+  cli();
+  int resonance = constrain(filterResonance + filterResonanceMod, 0, 255);
+  long fb = (long)resonance + (long)(((long)resonance * ((int)384 - (255-filterCutoff))) >> 8);
+  byte r = resonance >> 2;
+  unsigned int q = pgm_read_word(&svfDamping[r]);
+  uint32_t f = ((uint32_t)pgm_read_word(&svfFrequency[filterCutoff]) * envelopeRateScale) >> 8;
+  unsigned int fLimit = pgm_read_word(&svfFrequencyLimit[r]);
+  if (f > fLimit) {
+    f = fLimit;
+  }
+
+  feedback = fb;
+  svfF = f;
+  svfQ = q;
+  SREG = oldSREG;
 }
 
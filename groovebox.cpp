@@ -88,12 +88,7 @@ void grooveboxNoteOn(byte channelNum, byte midiNote, byte velocity) {
   if (channelNum == 10) {
     setDrumParameters(ni, midiNote, velocity);
   }
-  note[ni].volumeScale = track[currentTrack].volumeScale;
-  if (note[ni].volumeScale != 1.0) {
-    if (note[ni].isSample) {
-      note[ni].doScale = true;
-    }
-  }
+  note[ni].volumeScale = (byte)(track[currentTrack].volumeScale * MAX_NOTE_VOL);
   note[ni].isPreview = seqPreview;
   if ((!seqPreview) && (seqRunning || seqSynchStart)) {
     sn = &seq[seqSnapIndex][currentTrack];
@@ -120,9 +115,9 @@ void grooveboxNoteOn(byte channelNum, byte midiNote, byte velocity) {
 void grooveboxNoteOff(byte channelNum, byte midiNote, byte velocity) {
   if ((seqPreview) || (!seqRunning)) {
     if (channelNum == 10) {
-      doDrumNoteOff(midiNote);
+      doDrumNoteOff(midiNote, getSampleCount());
     } else {
-      doNoteOff(selectedSettings+1, midiNote);
+      doNoteOff(selectedSettings+1, midiNote, getSampleCount());
     }
     return;
   }
@@ -257,20 +252,14 @@ void doGroovebox() {
 	      if (!isDrumChannel) {
 		// already taken care of in setDrumParameters().
 		note[nextsn->noteIndex].sampleLength = sampleLength[nextsn->waveform - N_WAVEFORMS];
-		note[nextsn->noteIndex].volIndex = note[nextsn->noteIndex].targetVolIndex;
-		note[nextsn->noteIndex].volume = logVolume[note[nextsn->noteIndex].volIndex];
-		note[nextsn->noteIndex].volumeNext = note[nextsn->noteIndex].volume;
 	      }
 	    } else {
 	      note[nextsn->noteIndex].isSample = false;
 	    }
+	    selectKernel(nextsn->noteIndex);
 
-	    note[nextsn->noteIndex].volumeScale = track[t].volumeScale;
-	    if (note[nextsn->noteIndex].volumeScale != 1.0) {
-	      if (note[nextsn->noteIndex].isSample) {
-		note[nextsn->noteIndex].doScale = true;
-	      }
-	    }
+	    note[nextsn->noteIndex].volumeScale = (byte)(track[t].volumeScale * MAX_NOTE_VOL);
+	    startNoteNow(nextsn->noteIndex);
 	  }
 	}
       } // track in SEQ_PLAY state
@@ -323,7 +312,7 @@ void doGroovebox() {
 	if (seqIndex == 0) {
 	  metronomeNoteIndex = metronomeTick(64, MAX_NOTE_VOL);
 	} else {
-	  metronomeNoteIndex = metronomeTick(60, 40);
+	  metronomeNoteIndex = metronomeTick(60, 160);
 	}
       }
     }
@@ -384,12 +373,7 @@ void readGrooveboxButtons() {
 	  // save procedure
 	  return;
 	}
-#ifdef MIDI_ENABLE
-	MIDI.read();
-#endif
-#ifdef USBMIDI_ENABLE
-	USBMIDI.read();
-#endif
+	readMIDI();
       }
     }
     seqSynchStart = false;
@@ -447,18 +431,17 @@ void stopSequencer() {
 }
 
 byte metronomeTick(byte midiNote, byte volume) {
-  byte i = findNoteIndex();
+  byte i = findNoteIndex(0, midiNote);
   initNote(i, midiNote);
-  note[i].startTime = millis();
   note[i].waveform = METRONOME_WAVEFORM;
   note[i].waveformBuf = waveformBuffers[METRONOME_WAVEFORM];
   note[i].isSample = true;
   note[i].sampleLength = sampleLength[METRONOME_WAVEFORM - N_WAVEFORMS];
   note[i].envelopePhase = ATTACK;
-  note[i].volIndex = volume;
-  note[i].volume = volume;
-  note[i].volumeNext = volume;
+  note[i].peakIndex = pgm_read_byte(&inverseLogVolume[volume]);
+  selectKernel(i);
   setPhaseIncrement(i);
+  updateVoice(i);
   return i;
 }
 
@@ -17,6 +17,7 @@
 */
 
 #include "synthino_xm.h"
+#include "waveforms.h"
 
 void hardwareInit() {
   pinMode(BUTTON1_PIN, INPUT_PULLUP);
@@ -31,14 +32,22 @@ void hardwareInit() {
   analogReference(AREF_EXTERNAL_B);
 
   // Configure DAC
+#ifdef STEREO_OUTPUT
+  DACB.CTRLA = DAC_CH0EN_bm | DAC_CH1EN_bm | DAC_ENABLE_bm;
+  DACB.CTRLB = DAC_CHSEL_DUAL_gc;
+#else
   DACB.CTRLA = DAC_CH0EN_bm | DAC_ENABLE_bm;
   DACB.CTRLB = DAC_CHSEL_SINGLE_gc;
+#endif
   DACB.CTRLC = DAC_REFSEL_INT1V_gc;
 
   // Bring the DAC up to the middle of the voltage scale
   // gradually to avoid a pop.
   for(int i=0;i<=SILENCE;i++) {
     DACB.CH0DATA = i;
+#ifdef STEREO_OUTPUT
+    DACB.CH1DATA = i;
+#endif
     delayMicroseconds(10);
   }
 
@@ -50,17 +59,8 @@ void hardwareInit() {
   TCC0.CTRLC = 0;
   TCC0.CTRLD = 0;
   TCC0.CTRLE = 0;
-  TCC0.PER = (int)(F_CPU / OUTPUT_RATE);  // 32MHz / 25KHz = 1280 cycles
-  TCC0.INTCTRLA = TC_OVFINTLVL_HI_gc;
-
-  // LFO update timer
-  TCC1.CTRLA = TC_CLKSEL_DIV1_gc ; // 1:1 with main clock
-  TCC1.CTRLB = 0;
-  TCC1.CTRLC = 0;
-  TCC1.CTRLD = 0;
-  TCC1.CTRLE = 0;
-  TCC1.PER = (int)(F_CPU / 1000); // once per millisecond, 1kHz
-  TCC1.INTCTRLA = TC_OVFINTLVL_LO_gc;
+  TCC0.PER = (int)(F_CPU / outputRate);  // 32MHz / 25KHz = 1280 cycles
+  TCC0.INTCTRLA = 0; // the overflow only triggers the DMA, no interrupt
 
   // 96 pulses-per-quarter MIDI sync timer
   TCE0.CTRLA = TC_CLKSEL_DIV8_gc ; // divide by 8 for prescaler
@@ -71,4 +71,83 @@ void hardwareInit() {
   TCE0.PER = (F_CPU / 8) / (((DEFAULT_BPM<<1) * PPQ) / 60);
   TCE0.INTCTRLA = TC_OVFINTLVL_LO_gc;
 
+  // Configure DMA
+  // Channels 0 and 1 form a double-buffered pair that feeds the DAC from
+  // audioBuf[], one AUDIO_FRAME_BYTES sample per TCC0 overflow. The
+  // transaction complete interrupt of each channel renders the next block.
+  for(byte b=0;b<2;b++) {
+    for(byte s=0;s<AUDIO_BLOCK_SIZE * AUDIO_CHANNELS;s++) {
+      audioBuf[b][s] = SILENCE;
+    }
+  }
+  DMA.CTRL = 0;
+  DMA.CTRL = DMA_RESET_bm;
+  while (DMA.CTRL & DMA_RESET_bm);
+  DMA.CTRL = DMA_ENABLE_bm | DMA_DBUFMODE_CH01_gc | DMA_PRIMODE_RR0123_gc;
+  initAudioDMAChannel(&DMA.CH0, audioBuf[0]);
+  initAudioDMAChannel(&DMA.CH1, audioBuf[1]);
+  DMA.CH0.CTRLA |= DMA_CH_ENABLE_bm;
+}
+
+const unsigned int outputRates[N_OUTPUT_RATES] PROGMEM = {25000, 16000, 32000};
+
+// Select the output sample rate and derive everything that depends on
+// it: the audio timer period, the phase increment tables for waveforms
+// and for the drum samples (which are recorded at SAMPLE_RATE, so middle
+// C plays them at an increment of 1), the scale that keeps envelope
+// times the same at every rate, and the voice limit. The phase increments of the notes that
+// are playing are recomputed by the next setPhaseIncrement(). This is
+// the only place pitch uses floating point. A setting out of range, as
+// read from an erased EEPROM, selects the default rate.
+void setOutputRate(byte setting) {
+  if (setting >= N_OUTPUT_RATES) {
+    setting = OUTPUT_RATE_DEFAULT;
+  }
+  outputRateSetting = setting;
+  outputRate = pgm_read_word(&outputRates[setting]);
+  for(byte s=0;s<12;s++) {
+    float octave = pow(2, (PITCH_TOP_OCTAVE + s - 69) / 12.0);
+    waveSemitoneInc[s] = (uint32_t)(440.0 * octave * N_WAVEFORM_SAMPLES / outputRate * 65536.0);
+    octave = pow(2, (PITCH_TOP_OCTAVE + s - 60) / 12.0);
+    sampleSemitoneInc[s] = (uint32_t)(octave * SAMPLE_RATE / outputRate * 65536.0);
+  }
+  envelopeRateScale = ((uint32_t)SAMPLE_RATE << 8) / outputRate;
+  setFilterFeedback();
+  for(byte lfo=0;lfo<NUM_LFO;lfo++) {
+    updateLFO(lfo);
+  }
+  // 32MHz / 16KHz = 2000, / 25KHz = 1280, / 32KHz = 1000 cycles
+  TCC0.PERBUF = (int)(F_CPU / outputRate);
+  for(byte i=0;i<MAX_NOTES;i++) {
+    note[i].lastPitch = 0;
+  }
+  // the rate sets how many voices there is time for
+  updateVoiceLimit();
+}
+
+void initAudioDMAChannel(DMA_CH_t *ch, uint16_t *buf) {
+#ifdef STEREO_OUTPUT
+  // A burst writes a left and right pair to CH0DATA and CH1DATA, which
+  // are next to each other, so the DAC channels update together.
+  ch->CTRLA = DMA_CH_BURSTLEN_4BYTE_gc | DMA_CH_SINGLE_bm | DMA_CH_REPEAT_bm;
+#else
+  ch->CTRLA = DMA_CH_BURSTLEN_2BYTE_gc | DMA_CH_SINGLE_bm | DMA_CH_REPEAT_bm;
+#endif
+  // Interrupt levels: the serial receive interrupt is high so MIDI bytes
+  // are not lost while a block renders, rendering is medium, and the
+  // sequencer timer (TCE0) is low, so its voice commands never preempt
+  // the render ISR.
+  ch->CTRLB = DMA_CH_TRNINTLVL_MED_gc;
+  // source walks through the buffer and starts over every block,
+  // destination is the 16-bit DAC data register for every burst.
+  ch->ADDRCTRL = DMA_CH_SRCRELOAD_BLOCK_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_BURST_gc | DMA_CH_DESTDIR_INC_gc;
+  ch->TRIGSRC = DMA_CH_TRIGSRC_TCC0_OVF_gc;
+  ch->TRFCNT = AUDIO_BLOCK_SIZE * AUDIO_FRAME_BYTES;
+  ch->REPCNT = 0; // repeat forever
+  ch->SRCADDR0 = ((uint16_t)buf) & 0xFF;
+  ch->SRCADDR1 = ((uint16_t)buf) >> 8;
+  ch->SRCADDR2 = 0;
+  ch->DESTADDR0 = ((uint16_t)&DACB.CH0DATA) & 0xFF;
+  ch->DESTADDR1 = ((uint16_t)&DACB.CH0DATA) >> 8;
+  ch->DESTADDR2 = 0;
 }
@@ -24,7 +24,6 @@
 
 boolean resetPressed = false;
 unsigned long resetPressTime;
-float tuningAdjustment = BASE_TUNING_ADJUSTMENT;
 byte patch = UNSET;
 
 
@@ -62,8 +61,6 @@ void reset(boolean softReset) {
   arpRunning = false;
   seqRunning = false;
 
-  initNoise();
-
   for(int i=0;i<4;i++) {
     buttonState[i] = HIGH;
     buttonReleaseState[i] = HIGH;
@@ -71,6 +68,7 @@ void reset(boolean softReset) {
     ledEventTimer[i] = 0L;
   }
 
+  initVoiceLists();
   for(int i=0;i<MAX_NOTES;i++) {
     stopNote(i);
   }
@@ -79,17 +77,15 @@ void reset(boolean softReset) {
     note[i].midiVal = NOTE_OFF;
     note[i].midiChannel = 0;
     note[i].trigger = UNSET;
-    note[i].frequency = 0;
-    note[i].lastFrequency = 0;
+    note[i].pitch = 0;
+    note[i].lastPitch = 0;
     note[i].waveform = 0;
     note[i].waveformBuf = waveformBuffers[0];
     note[i].isSample = false;
     note[i].isPreview = false;
-    note[i].phase = 0;
     note[i].phaseInc = 0;
-    note[i].phaseFraction = 0;
-    note[i].phaseFractionInc = 0;
     note[i].envelopePhase = OFF;
+    selectKernel(i);
   }
 
   button[0].midiVal = 60;
@@ -99,7 +95,9 @@ void reset(boolean softReset) {
 
   filterCutoff = 255; // set to highest value regardless of pot position.
   filterResonance = 255;
+  filterMode = FILTER_MODE_LEGACY;
   setFilterFeedback();
+  clearModMatrix();
   filterCutoffPotTolerance = POT_LOCK_TOLERANCE;
   filterResonancePotTolerance = POT_LOCK_TOLERANCE;
 
@@ -123,16 +121,16 @@ void reset(boolean softReset) {
     }
   }
 
+  setHeadroom(HEADROOM_DEFAULT);
+  // Fill the pitch tables for the default rate first, since a blank or
+  // cleared EEPROM leaves readGlobalSettings() without a rate to set.
+  setOutputRate(OUTPUT_RATE_DEFAULT);
   readGlobalSettings();
   if ((buttonPressed(BUTTON4)) && (!softReset)) {
     adjustTuning();
   }
 
-  // precompute frequencies. Indexed by MIDI note number.
-  tuningAdjustment = BASE_TUNING_ADJUSTMENT + ((float)tuningSetting) / 256.0; // [-2, 2]
-  for(int i=MIDI_LOW;i<=MIDI_HIGH;i++) {
-    noteTable[i-MIDI_LOW] = 440.0 * (pow(2, ((i-69)+tuningAdjustment)/12.0));
-  }
+  tuningPitch = BASE_TUNING_PITCH + tuningSetting; // [-2, 2] semitones
 
   mode = selectMode();
 
@@ -188,6 +186,11 @@ void reset(boolean softReset) {
     settings[i].releaseReading = sampledAnalogRead(RELEASE_TIME_POT);
     settings[i].pitchBend = 0;
     settings[i].detune = 0.0;
+    settings[i].interpolate = false;
+    settings[i].pan = PAN_CENTER;
+    settings[i].voiceFilterCutoff = VOICE_FILTER_OFF;
+    settings[i].voiceFilterEnvelope = 0;
+    settings[i].noiseColor = NOISE_WHITE;
     settings[i].waveformReading = sampledAnalogRead(WAVEFORM_SELECT_POT);
 
     int setting = map(settings[i].attackReading, POT_MIN, 1023, 1, ATTACK_RANGE);
@@ -216,6 +219,8 @@ void reset(boolean softReset) {
 
     settings[i].waveform = map(settings[i].waveformReading, 0, 1024, 0, N_TOTAL_WAVEFORMS);
   }
+  // a soft reset may leave the voices of the filtered limit parked
+  updateVoiceLimit();
 
   lastLFOWaveformReading = sampledAnalogRead(LFO_WAVEFORM_SELECT_POT);
   lfoWaveform = map(lastLFOWaveformReading, 0, 1024, 0, N_LFO_WAVEFORMS);
@@ -251,9 +256,7 @@ void reset(boolean softReset) {
   delay(50);
 
 #ifdef DEBUG_ENABLE
-  debugprint("tuningAdjustment=", tuningAdjustment);
-  debugprint(" A4=", noteTable[69-MIDI_LOW], 4);
-  debugprintln(" Hz");
+  debugprintln("tuningPitch=", tuningPitch);
 #endif
 
 }
@@ -266,23 +269,23 @@ void adjustTuning() {
 
   // start playing an A4
   initNote(0, 69);
-  note[0].frequency = 440.0;
+  note[0].pitch = 69 << PITCH_FRACTION_BITS;
+  note[0].peakIndex = MAX_NOTE_VOL;
   setPhaseIncrement(0);
-  note[0].volume = MAX_NOTE_VOL;
-  note[0].volumeNext = MAX_NOTE_VOL;
+  updateVoice(0);
   while (buttonPressed(BUTTON4)) {
     tuningSetting = map(sampledAnalogRead(7), 0, 1023, -512, 511);
-    tuningAdjustment = (float)(BASE_TUNING_ADJUSTMENT + ((float)tuningSetting) / 256.0); // [-2, 2]
-    note[0].frequency = 440.0 * (pow(2, (tuningAdjustment)/12.0));
+    tuningPitch = BASE_TUNING_PITCH + tuningSetting; // [-2, 2] semitones
+    note[0].lastPitch = 0; // the pitch is the same, but the tuning is not
 #ifdef DEBUG_ENABLE
     delay(100);
-    debugprint("tuningAdjustment = ", tuningAdjustment, 4);
-    debugprintln("   f = ", note[0].frequency, 4);
+    debugprintln("tuningPitch = ", tuningPitch);
 #endif
     setPhaseIncrement(0);
+    updateVoice(0);
     delay(10);
   }
-  note[0].midiVal = NOTE_PENDING_OFF;
+  stopNote(0);
   writeGlobalSettings();
 }
 
@@ -361,11 +364,12 @@ void beep(byte midiVal, int duration) {
   initNote(0, midiVal);
   beepNote->waveform = 1;
   beepNote->waveformBuf = waveformBuffers[1];
-  beepNote->frequency = 440.0 * (pow(2, ((midiVal-69))/12.0));
-  beepNote->volume = MAX_NOTE_VOL;
-  beepNote->volumeNext = MAX_NOTE_VOL;
+  beepNote->pitch = midiVal << PITCH_FRACTION_BITS;
+  beepNote->peakIndex = MAX_NOTE_VOL;
+  selectKernel(0);
   setPhaseIncrement(0);
+  updateVoice(0);
   delay(duration);
-  beepNote->midiVal = NOTE_PENDING_OFF;
+  stopNote(0);
 }
 
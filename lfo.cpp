@@ -19,24 +19,87 @@
 #include "synthino_xm.h"
 #include "waveforms.h"
 
-// LFO parameters
-float lfoFrequency[NUM_LFO] = {0.0, 0.0};
-float lfoDepth[NUM_LFO] = {0.0, 0.0};
-float lfoShift[NUM_LFO];
+// LFO parameters. The control code sets the rate and depth, and the
+// output ISR runs the LFOs, see advanceLFOs().
+unsigned int lfoFrequency[NUM_LFO] = {0, 0}; // see LFO_FREQUENCY_FRACTION_BITS
+unsigned int lfoDepth[NUM_LFO] = {0, 0}; // of 2048, up to one half
 byte lfoWaveform = 0;
 const int16_t *lfoWaveformBuf = lfoWaveformBuffers[0];
-volatile unsigned int lfoPhase[NUM_LFO] = {0, 0};
-volatile unsigned int lfoPhaseInc[NUM_LFO] = {0, 0};
-volatile byte lfoPhaseFraction[NUM_LFO] = {0, 0};
-volatile byte lfoPhaseFractionInc[NUM_LFO] = {0, 0};
+uint32_t lfoPhase[NUM_LFO] = {0, 0}; // the top 9 bits index the waveform
+uint32_t lfoPhaseInc[NUM_LFO] = {0, 0}; // per sample
+int lfoLevel[NUM_LFO]; // waveform times depth, of 1024
+// The pitch LFO for each sample of the block, as the ratio it moves the
+// phase increments of the wavetable and noise voices by, less one, in 2.14 fixed
+// point. See renderVoice().
+int lfoPitchMod[AUDIO_BLOCK_SIZE];
+boolean lfoPitchModOn = false;
 
+// Set the phase increment of LFO lfoNum for its frequency at the output
+// rate. Called when the frequency or the output rate changes.
 void updateLFO(byte lfoNum) {
-  float lfoPhaseIncFloat = (lfoFrequency[lfoNum] * N_WAVEFORM_SAMPLES) / LFO_CLOCK_RATE;
-  lfoPhaseInc[lfoNum] = (int)lfoPhaseIncFloat;
-  lfoPhaseIncFloat -= lfoPhaseInc[lfoNum];
-  lfoPhaseFractionInc[lfoNum] = (int)(lfoPhaseIncFloat * 256.0);
-  // lfoShift is how much to change the modulated parameter.  Range is [-1.0:1.0]
-  lfoShift[lfoNum] = (((int)pgm_read_word(lfoWaveformBuf + lfoPhase[lfoNum]))/1024.0);
+  // 2^32 * f / outputRate, with f in 1/16Hz
+  uint32_t inc = (((uint32_t)lfoFrequency[lfoNum] << 19) / outputRate) << (13 - LFO_FREQUENCY_FRACTION_BITS);
+  byte oldSREG = SREG;
+  cli();
+  lfoPhaseInc[lfoNum] = inc;
+  SREG = oldSREG;
+}
+
+// Start LFO lfoNum at the beginning of its waveform.
+void resetLFO(byte lfoNum) {
+  byte oldSREG = SREG;
+  cli();
+  lfoPhase[lfoNum] = 0;
+  SREG = oldSREG;
+}
 
+// The largest pitch change the pitch LFO can make at its depth, for
+// choosing the mipmap of a note (see setPhaseIncrement()).
+int lfoPitchPeak() {
+  if (!lfoEnabled[LFO_PITCH]) {
+    return 0;
+  }
+  return ((long)lfoDepth[LFO_PITCH] * LFO_PITCH_RANGE) >> 11;
 }
 
+// An LFO waveform value as a modulation source, -128..127
+static inline int8_t lfoSource(int w) {
+  return constrain(w >> 3, -128, 127);
+}
+
+// Step the LFOs by one block and apply them. The filter LFO sets
+// lfoLevel[LFO_FILTER] once per block, which advanceModulation() adds
+// to the cutoff. The pitch LFO runs at the audio rate: it fills
+// lfoPitchMod[], and the wavetable and noise kernels
+// apply it to their phase increment every sample, so a fast LFO gives
+// clean vibrato and FM-like sidebands instead of steps. That costs
+// about 90 cycles per sample here, once for all voices, mostly in
+// pitchRatio(). Called by the output ISR, so the modulation does not
+// depend on how busy loop() is.
+//
+// Both LFOs also run while their depth is off, as sources of the
+// modulation matrix at full swing.
+void advanceLFOs() {
+  lfoPhase[LFO_FILTER] += lfoPhaseInc[LFO_FILTER] * AUDIO_BLOCK_SIZE;
+  int w = pgm_read_word(lfoWaveformBuf + (lfoPhase[LFO_FILTER] >> (32 - 9)));
+  lfoLevel[LFO_FILTER] = (lfoEnabled[LFO_FILTER]) ? ((long)w * lfoDepth[LFO_FILTER]) >> 11 : 0;
+  modSource[MOD_SRC_LFO_FILTER] = lfoSource(w);
+
+  lfoPitchModOn = lfoEnabled[LFO_PITCH];
+  if (lfoPitchModOn) {
+    // pitch at full waveform, lfoPitchPeak() times 1024
+    int range = ((long)lfoDepth[LFO_PITCH] * LFO_PITCH_RANGE) >> 11;
+    uint32_t phase = lfoPhase[LFO_PITCH];
+    uint32_t inc = lfoPhaseInc[LFO_PITCH];
+    for(byte s=0;s<AUDIO_BLOCK_SIZE;s++) {
+      phase += inc;
+      int w = pgm_read_word(lfoWaveformBuf + (phase >> (32 - 9)));
+      lfoPitchMod[s] = pitchRatio(((long)w * range) >> 10) - (1 << 14);
+    }
+    lfoPhase[LFO_PITCH] = phase;
+  } else {
+    lfoPhase[LFO_PITCH] += lfoPhaseInc[LFO_PITCH] * AUDIO_BLOCK_SIZE;
+  }
+  w = pgm_read_word(lfoWaveformBuf + (lfoPhase[LFO_PITCH] >> (32 - 9)));
+  modSource[MOD_SRC_LFO_PITCH] = lfoSource(w);
+}
@@ -29,6 +29,10 @@ unsigned long lastClockPulse;
 int bpmMeasurements[N_BPM_MEASUREMENTS];
 int clockMeasurementCount = 0;
 
+#define MIDI_SOURCE_DIN 0
+#define MIDI_SOURCE_USB 1
+byte midiSource = MIDI_SOURCE_DIN; // where the message being handled came from
+
 void midiInit() {
 #ifdef MIDI_ENABLE
   // Initialize MIDI library.
@@ -38,6 +42,7 @@ void midiInit() {
   MIDI.setHandleProgramChange(handleProgramChange);
   MIDI.setHandleControlChange(handleControlChange);
   MIDI.setHandlePitchBend(handlePitchBend);
+  MIDI.setHandleAfterTouchChannel(handleAfterTouch);
   MIDI.setHandleStart(handleStart);
   MIDI.setHandleContinue(handleContinue);
   MIDI.setHandleStop(handleStop);
@@ -51,6 +56,7 @@ void midiInit() {
   USBMIDI.setHandleProgramChange(handleProgramChange);
   USBMIDI.setHandleControlChange(handleControlChange);
   USBMIDI.setHandlePitchBend(handlePitchBend);
+  USBMIDI.setHandleAfterTouchChannel(handleAfterTouch);
   USBMIDI.setHandleStart(handleStart);
   USBMIDI.setHandleContinue(handleContinue);
   USBMIDI.setHandleStop(handleStop);
@@ -67,6 +73,41 @@ void updateMIDIClockInfo() {
   }
 }
 
+// Parse the MIDI input received since the last call. The handlers
+// are called from here.
+void readMIDI() {
+#ifdef MIDI_ENABLE
+  midiSource = MIDI_SOURCE_DIN;
+  while (MIDI.read());
+#endif
+#ifdef USBMIDI_ENABLE
+  midiSource = MIDI_SOURCE_USB;
+  while (USBMIDI.read());
+#endif
+}
+
+// Sample time to play the MIDI message being handled at. Notes are
+// played a fixed MIDI_LATENCY after they arrived, so the time it takes
+// loop() to get to them does not change their timing.
+// DIN MIDI bytes are stamped with the low 16 bits of getSampleTime() by
+// the serial receive interrupt. It runs at high level, above the render
+// ISR, so the stamp is a sample or two after the stop bit of the byte,
+// unless interrupts are disabled, which only the short sections that
+// read shared state and the EEPROM access do. The stamp of the last
+// byte of the message is extended to 32 bits here. A stamp that is more than 65536
+// samples old comes out late, which only means the note plays at once.
+// USB MIDI messages are only seen when loop() polls for them, so they
+// are timed from when they are read.
+uint32_t midiEventTime() {
+  uint32_t now = getSampleTime();
+#ifdef MIDI_ENABLE
+  if (midiSource == MIDI_SOURCE_DIN) {
+    now -= (uint16_t)((uint16_t)now - USE_SERIAL_PORT.readTime());
+  }
+#endif
+  return now + MIDI_LATENCY;
+}
+
 void handleNoteOn(byte channelNum, byte midiNote, byte velocity) { 
 #ifdef DEBUG_ENABLE
   if (debug) {
@@ -92,12 +133,16 @@ void handleNoteOn(byte channelNum, byte midiNote, byte velocity) {
 	// if the note came in on the drum channel (10), do special processing
 	setDrumParameters(noteIndex, midiNote, velocity);
       }
+      // Queue the start now with its time, rather than on the next pass of
+      // loop(), so the output ISR has it well before it is due.
+      scheduleNote(noteIndex, midiEventTime());
+      startNoteNow(noteIndex);
     } else {
       // note off
       if (isDrumChannel) {
-	doDrumNoteOff(midiNote);
+	doDrumNoteOff(midiNote, midiEventTime());
       } else {
-	doNoteOff(channelNum, midiNote);
+	doNoteOff(channelNum, midiNote, midiEventTime());
       }
     }
     return;
@@ -143,9 +188,9 @@ void handleNoteOff(byte channelNum, byte midiNote, byte velocity) {
   }
   if (mode == MODE_SYNTH) {
     if (isDrumChannel) {
-      doDrumNoteOff(midiNote);
+      doDrumNoteOff(midiNote, midiEventTime());
     } else {
-      doNoteOff(channelNum, midiNote);
+      doNoteOff(channelNum, midiNote, midiEventTime());
     }
     return;
   }
@@ -164,21 +209,32 @@ void handleNoteOff(byte channelNum, byte midiNote, byte velocity) {
   }
 }
 
-void doDrumNoteOff(byte midiNote) {
+void doDrumNoteOff(byte midiNote, uint32_t t) {
   for(byte i=0;i<MAX_NOTES;i++) {
     // find the note
     if ((note[i].origMidiVal == midiNote) && (note[i].midiVal > NOTE_PENDING_OFF) && (note[i].midiChannel & 0x80)) {
-      releaseNote(&note[i]);
+      scheduleRelease(&note[i], t);
     }
   }
 }
 
+// Stereo position of each drum, from MIDI note 35 to 81, as the
+// drummer sees the kit: hi-hat left, toms from high at the left to low
+// at the right, cymbals at the sides and hand percussion spread around.
+const byte drumPan[47] PROGMEM = {
+  64, 64, 56, 64, 72, 64, 96, 40,   // 35 bass drum 2 .. 42 closed hi-hat
+  88, 40, 80, 40, 72, 56, 32, 48,   // 43 low tom 1 .. 50 high tom 1
+  96, 24, 96, 80, 104, 32, 100, 24, // 51 ride cymbal 1 .. 58 vibra slap
+  96, 48, 56, 80, 80, 88, 40, 48,   // 59 ride cymbal 2 .. 66 low timbale
+  32, 40, 96, 104, 24, 24, 88, 88,  // 67 high agogo .. 74 long guiro
+  64, 48, 56, 72, 72, 104, 104      // 75 claves .. 81 open triangle
+};
+
 void setDrumParameters(byte i, byte midiNote, byte velocity) {
   note[i].midiChannel |= 0x80; // set high bit on channel to indicate it was a channel 10 drum
-  // Override what was done in doNoteOn()
-  note[i].volIndex = note[i].targetVolIndex;
-  note[i].volume = logVolume[note[i].volIndex];
-  note[i].volumeNext = note[i].volume;
+  if ((midiNote >= 35) && (midiNote <= 81)) {
+    note[i].pan = pgm_read_byte(&drumPan[midiNote - 35]);
+  }
 
   byte newMidiNote; // actual pitch to play
   byte waveform; // actual waveform to use
@@ -396,6 +452,7 @@ void setDrumParameters(byte i, byte midiNote, byte velocity) {
     note[i].sampleLength = (int)((origLength * length));
   }
   note[i].isSample = true;
+  selectKernel(i);
 }
 
 
@@ -478,15 +535,16 @@ void handleControlChange(byte channelNum, byte number, byte value) {
     }
     if (value > 0) {
       if (!lfoEnabled[lfoNum]) {
-	// reset the LFO phase
-	lfoPhase[lfoNum] = 0;
+	resetLFO(lfoNum);
       }
       lfoEnabled[lfoNum] = true;
+      // frequency in 1/16Hz
       if (value < 64) {
-	lfoFrequency[lfoNum] = value / 3.15; // map to frequency in range [0.0, 20.0]
+	lfoFrequency[lfoNum] = (value * 325) >> 6; // map to frequency in range [0.0, 20.0]
       } else {
-	lfoFrequency[lfoNum] = 20.0 + ((value-64) / 0.1575); // map to frequency in range [20.0 420.0]
+	lfoFrequency[lfoNum] = 320 + (((long)(value-64) * 813) >> 3); // map to frequency in range [20.0 420.0]
       }
+      updateLFO(lfoNum);
     } else {
       lfoEnabled[lfoNum] = false;
     }
@@ -498,11 +556,13 @@ void handleControlChange(byte channelNum, byte number, byte value) {
     lfoDepthPotTolerance = POT_LOCK_TOLERANCE;
     if (number == MODULATION_DEPTH) {
       lfoNum = LFO_PITCH;
+      // the mod wheel is a source of the modulation matrix as well
+      modSource[MOD_SRC_MOD_WHEEL] = value;
     } else {
       lfoNum = LFO_FILTER;
     }
     setting = map(value, 0, 127, 0, 1023);
-    lfoDepth[lfoNum] = setting / 2048.0;  // 0.0-0.5
+    lfoDepth[lfoNum] = setting;  // 0.0-0.5 of 2048
     return;
   }
 
@@ -526,7 +586,7 @@ void handleControlChange(byte channelNum, byte number, byte value) {
     setting = map(value, 0, 127, 0, 255);
     filterCutoffPotTolerance = POT_LOCK_TOLERANCE;
     filterCutoffReading = setting;
-    if (!lfoEnabled[LFO_FILTER]) {
+    if (!filterCutoffModulated) {
       filterCutoff = filterCutoffReading;
       setFilterFeedback();
     }
@@ -541,6 +601,51 @@ void handleControlChange(byte channelNum, byte number, byte value) {
     return;
   }
 
+  if (number == FILTER_MODE) {
+    setting = map(value, 0, 128, 0, N_FILTER_MODES);
+    if (setting != filterMode) {
+      // The modes keep different state in filterState, so what one
+      // leaves behind would kick the next one. Switch with the state
+      // cleared, where the output ISR can't filter in between.
+      byte oldSREG = SREG;
+      cli();
+      filterMode = setting;
+      for(byte i=0;i<AUDIO_CHANNELS;i++) {
+	filterState[i].buf0 = 0;
+	filterState[i].buf1 = 0;
+	filterState[i].low = 0;
+	filterState[i].band = 0;
+      }
+      SREG = oldSREG;
+    }
+    return;
+  }
+
+  if (number == MOD_SLOT) {
+    selectedModSlot = map(value, 0, 128, 0, N_MOD_SLOTS);
+    return;
+  }
+
+  if (number == MOD_SOURCE) {
+    modSlot[selectedModSlot].source = map(value, 0, 128, 0, N_MOD_SOURCES);
+    setModRouting();
+    return;
+  }
+
+  if (number == MOD_DESTINATION) {
+    modSlot[selectedModSlot].destination = map(value, 0, 128, 0, N_MOD_DESTINATIONS);
+    setModRouting();
+    return;
+  }
+
+  if (number == MOD_AMOUNT) {
+    // 64 is none, 0 and 127 are the full amount down and up
+    setting = value - 64;
+    modSlot[selectedModSlot].amount = (setting > 0) ? (setting * 127) / 63 : setting * 2;
+    setModRouting();
+    return;
+  }
+
   if (number == GENERAL_PURPOSE_1) {
     // tempo BPM for arpeggiator/groovebox.
     // this is an alternative to using the MIDI clock signal
@@ -589,19 +694,75 @@ void handleControlChange(byte channelNum, byte number, byte value) {
   }
 
   if (number == GENERAL_PURPOSE_4) {
-    float fSetting;
     if ((value > 52) && (value < 76)) {
-      fSetting = 0.0;
+      setting = 0;
     } else {
       if (value <= 52) {
 	// lower half of pot
-	setting = -(map(value, 0, 52, 1024, 0));
+	setting = -(map(value, 0, 52, 256, 0));
       } else {
-	setting = map(value, 76, 127, 0, 1024);
+	setting = map(value, 76, 127, 0, 256);
       }
-      fSetting = setting / 1024.0; // range is [-1.0, 1.0]
     }
-    settings[channelNum-1].detune = fSetting;
+    settings[channelNum-1].detune = setting; // up to a semitone
+    return;
+  }
+
+  if (number == GENERAL_PURPOSE_5) {
+    stealPolicy = map(value, 0, 128, 0, N_STEAL_POLICIES);
+    return;
+  }
+
+  if (number == GENERAL_PURPOSE_6) {
+    // takes effect on the next note of the channel
+    settings[channelNum-1].interpolate = (value >= 64);
+    return;
+  }
+
+  if (number == GENERAL_PURPOSE_8) {
+    byte headroom = map(value, 0, 128, 0, MAX_NOTES + 1);
+    if (headroom != headroomSetting) {
+      setHeadroom(headroom);
+      globalSettingsChanged();
+    }
+    return;
+  }
+
+  if (number == VOICE_FILTER_CUTOFF) {
+    // takes effect on the next note of the channel
+    settings[channelNum-1].voiceFilterCutoff = (value == 127) ? VOICE_FILTER_OFF : value << 1;
+    updateVoiceLimit();
+    return;
+  }
+
+  if (number == VOICE_FILTER_ENVELOPE) {
+    settings[channelNum-1].voiceFilterEnvelope = value << 1;
+    return;
+  }
+
+  if (number == NOISE_COLOR) {
+    // takes effect on the next note of the channel
+    settings[channelNum-1].noiseColor = map(value, 0, 128, 0, N_NOISE_COLORS);
+    return;
+  }
+
+  if (number == PAN) {
+    // takes effect on the next note of the channel
+    settings[channelNum-1].pan = (value == 127) ? PAN_RIGHT : value;
+    return;
+  }
+
+  if (number == GENERAL_PURPOSE_7) {
+    byte rate = OUTPUT_RATE_DEFAULT;
+    if (value < 43) {
+      rate = OUTPUT_RATE_LOW;
+    } else if (value >= 86) {
+      rate = OUTPUT_RATE_HIGH;
+    }
+    if (rate != outputRateSetting) {
+      setOutputRate(rate);
+      globalSettingsChanged();
+    }
     return;
   }
 
@@ -628,8 +789,7 @@ void handleControlChange(byte channelNum, byte number, byte value) {
       track[channelNum-1].volumeScale = (float)value / 127.0;
       for(byte i=0;i<MAX_NOTES;i++) {
 	if ((note[i].trigger == (channelNum-1)) || (note[i].isPreview) || (!seqRunning)) {
-	  note[i].volumeScale = track[channelNum-1].volumeScale;
-	  note[i].doScale = true;
+	  note[i].volumeScale = (byte)(track[channelNum-1].volumeScale * MAX_NOTE_VOL);
 	}
       }
     }
@@ -649,6 +809,18 @@ void handlePitchBend(byte channelNum, int bend) {
   settings[channelNum-1].pitchBend = bend;
 }
 
+// Channel pressure, a source of the modulation matrix for all channels.
+void handleAfterTouch(byte channelNum, byte pressure) {
+#ifdef DEBUG_ENABLE
+  if (debug) {
+    debugprint("AT ");
+    debugprint("ch ", channelNum);
+    debugprintln(" : ", pressure);
+  }
+#endif
+  modSource[MOD_SRC_AFTERTOUCH] = pressure & 0x7F;
+}
+
 void handleStart() {
 #ifdef DEBUG_ENABLE
   if (debug) {
@@ -32,10 +32,23 @@
 #define EFFECTS_1_DEPTH      91   // filter LFO depth
 #define TIMBRE               71   // filter resonance
 #define BRIGHTNESS           74   // filter cutoff frequency
+#define FILTER_MODE          85   // filter mode, legacy/low pass/high pass/band pass/notch, saved with patch
+#define VOICE_FILTER_CUTOFF  86   // cutoff of a filter on each voice of channel (127 for none)
+#define VOICE_FILTER_ENVELOPE 87  // how far the envelope opens the voice filters of channel
+#define NOISE_COLOR          88   // noise waveform of channel, white/pink/brown
+#define MOD_SLOT             102  // modulation matrix slot the next three controllers set
+#define MOD_SOURCE           103  // source of the slot, see MOD_SRC_NONE
+#define MOD_DESTINATION      104  // destination of the slot, see MOD_DST_PITCH
+#define MOD_AMOUNT           105  // amount of the slot, 64 for none, saved with patch
 #define GENERAL_PURPOSE_1    16   // arpeggiator/groovebox tempo BPM (maps to 20-300) (alternative to clock)
 #define GENERAL_PURPOSE_2    17   // arpeggiator note length
 #define GENERAL_PURPOSE_3    18   // arpeggiator/groovebox transpose
 #define GENERAL_PURPOSE_4    19   // detune channel
+#define GENERAL_PURPOSE_5    80   // voice stealing policy, all channels
+#define GENERAL_PURPOSE_6    81   // interpolated wavetable playback for channel (on at 64 and above)
+#define GENERAL_PURPOSE_7    82   // output sample rate, 16KHz/25KHz/32KHz, saved
+#define GENERAL_PURPOSE_8    83   // mix headroom, voices at full level (0 for none), saved
+#define PAN                  10   // stereo position of channel, stereo builds only
 #define CHANNEL_VOLUME       7    // used in groovebox mode
 #define CHANNEL_VOLUME_T1    20   // alternate for track 1 volume, regardless of channel
 #define CHANNEL_VOLUME_T2    21   // alternate for track 2 volume, regardless of channel
@@ -0,0 +1,169 @@
+/*
+  Synthino polyphonic synthesizer
+  Copyright (C) 2014-2015 Michael Krumpus
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "synthino_xm.h"
+#include "waveforms.h"
+
+// Modulation matrix. Each slot routes a source to a destination by a
+// signed amount. The slots are compiled into a list of routes for each
+// destination by setModRouting(), and the output ISR only walks the
+// lists, once per block for the output filter and once per block and
+// voice for the voice destinations (see modulateVoice() in output.cpp).
+// An empty list costs a compare, so the matrix is free until it is used.
+// The LFO pots keep working as before next to it.
+modSlot_t modSlot[N_MOD_SLOTS];
+byte selectedModSlot = 0; // slot the MOD_SOURCE, MOD_DESTINATION and MOD_AMOUNT controllers set
+
+// Values of the global sources, -128..127 or 0..127. The entries of the
+// voice sources are not used, those come from each voice.
+volatile int8_t modSource[N_MOD_SOURCES];
+
+// Routes of each destination, and of MOD_DST_VOICE_CUTOFF. Written with
+// interrupts off, since the ISR reads them.
+modRoute_t modRoutes[N_MOD_ROUTE_LISTS][N_MOD_SLOTS];
+byte nModRoutes[N_MOD_ROUTE_LISTS];
+
+// Highest pitch the pitch routes can add, for the mipmap of a note (see
+// setPhaseIncrement()).
+int modPitchPeak = 0;
+
+// True while the ISR sets filterCutoff, from the filter LFO or cutoff
+// routes. The knob only sets filterCutoffReading then.
+volatile boolean filterCutoffModulated = false;
+
+static boolean isVoiceSource(byte source) {
+  return (source == MOD_SRC_ENVELOPE) || (source == MOD_SRC_VELOCITY) || (source == MOD_SRC_KEY);
+}
+
+void clearModMatrix() {
+  for(byte i=0;i<N_MOD_SLOTS;i++) {
+    modSlot[i].source = MOD_SRC_NONE;
+    modSlot[i].destination = MOD_DST_PITCH;
+    modSlot[i].amount = 0;
+  }
+  setModRouting();
+}
+
+// Compile the slots into the route lists. Slots without a source or
+// amount are left out. Cutoff routes from the voice sources go to the
+// voice filters, and resonance has no voice version, so those routes
+// are left out too.
+void setModRouting() {
+  modRoute_t routes[N_MOD_ROUTE_LISTS][N_MOD_SLOTS];
+  byte n[N_MOD_ROUTE_LISTS];
+  int pitchPeak = 0;
+  for(byte d=0;d<N_MOD_ROUTE_LISTS;d++) {
+    n[d] = 0;
+  }
+  for(byte i=0;i<N_MOD_SLOTS;i++) {
+    modSlot_t *slot = &modSlot[i];
+    byte d = slot->destination;
+    if ((slot->source == MOD_SRC_NONE) || (slot->source >= N_MOD_SOURCES) ||
+	(d >= N_MOD_DESTINATIONS) || (slot->amount == 0)) {
+      continue;
+    }
+    if (isVoiceSource(slot->source)) {
+      if (d == MOD_DST_CUTOFF) {
+	d = MOD_DST_VOICE_CUTOFF;
+      } else if (d == MOD_DST_RESONANCE) {
+	continue;
+      }
+    }
+    routes[d][n[d]].source = slot->source;
+    routes[d][n[d]].amount = slot->amount;
+    n[d]++;
+    if (d == MOD_DST_PITCH) {
+      pitchPeak += abs(slot->amount);
+    }
+  }
+  // see modulateVoice()
+  pitchPeak = min(pitchPeak * 24, (12 << PITCH_FRACTION_BITS) - 1);
+
+  byte oldSREG = SREG;
+  cli();
+  memcpy(modRoutes, routes, sizeof(routes));
+  memcpy(nModRoutes, n, sizeof(n));
+  SREG = oldSREG;
+  modPitchPeak = pitchPeak;
+}
+
+// The sum of the routes of list, each one the source value times its
+// amount, of 128. envelope, velocity and key are the voice sources of
+// the voice being modulated, 0 for the global destinations. About 40
+// cycles per route.
+int modulation(byte list, int8_t envelope, int8_t velocity, int8_t key) {
+  int sum = 0;
+  const modRoute_t *route = modRoutes[list];
+  for(byte r=nModRoutes[list];r>0;r--,route++) {
+    int8_t x;
+    switch (route->source) {
+    case MOD_SRC_ENVELOPE:
+      x = envelope;
+      break;
+    case MOD_SRC_VELOCITY:
+      x = velocity;
+      break;
+    case MOD_SRC_KEY:
+      x = key;
+      break;
+    default:
+      x = modSource[route->source];
+      break;
+    }
+    sum += ((int)x * route->amount) >> 7;
+  }
+  return sum;
+}
+
+// Apply the global destinations, cutoff and resonance of the output
+// filter, for the next block. Called by the output ISR after
+// advanceLFOs().
+void advanceModulation() {
+  boolean cutoffModulated = (lfoEnabled[LFO_FILTER]) || (nModRoutes[MOD_DST_CUTOFF] != 0);
+  int resonance = 0;
+  if (nModRoutes[MOD_DST_RESONANCE] != 0) {
+    resonance = modulation(MOD_DST_RESONANCE, 0, 0, 0);
+  }
+  if (cutoffModulated) {
+    int cutoff = filterCutoffReading + (lfoLevel[LFO_FILTER] >> 3);
+    if (nModRoutes[MOD_DST_CUTOFF] != 0) {
+      cutoff += modulation(MOD_DST_CUTOFF, 0, 0, 0);
+    }
+    filterCutoff = constrain(cutoff, 0, 255);
+  }
+  filterCutoffModulated = cutoffModulated;
+  resonance = constrain(resonance, -128, 127);
+  if ((cutoffModulated) || (resonance != filterResonanceMod)) {
+    filterResonanceMod = resonance;
+    setFilterFeedback();
+  }
+}
+
+// The waveform a note of waveform starts with, moved along the single
+// cycle waveforms by the WAVEFORM routes. The control code calls this
+// at note on, with the velocity (0..127) and key sources of the note.
+// Noise and samples are left alone.
+byte modulatedWaveform(byte waveform, byte velocity, byte midiNote) {
+  const byte nWavetables = N_WAVEFORMS - 1; // the last one is noise
+  if ((nModRoutes[MOD_DST_WAVEFORM] == 0) || (waveform >= nWavetables)) {
+    return waveform;
+  }
+  int key = constrain(((int)midiNote - 60) * 2, -128, 127);
+  int offset = (modulation(MOD_DST_WAVEFORM, 0, velocity, key) * (nWavetables - 1)) >> 7;
+  return constrain((int)waveform + offset, 0, nWavetables - 1);
+}
@@ -20,310 +20,1410 @@
 #include "synthino_xm.h"
 #include "waveforms.h"
 
-ISR(TCC0_OVF_vect) {
-  byte last;
+// Double buffer of DAC samples. DMA channels 0 and 1 are run as a
+// double-buffered pair: each one moves a block of samples to DACB.CH0DATA,
+// one sample per TCC0 overflow, and when it finishes the other channel takes
+// over. The transaction complete interrupt of a channel then renders the
+// next block into the buffer that channel just finished playing. With
+// STEREO_OUTPUT the samples are left and right pairs, and each overflow
+// moves a pair to DACB.CH0DATA and CH1DATA.
+uint16_t audioBuf[2][AUDIO_BLOCK_SIZE * AUDIO_CHANNELS];
 
-  // output to DAC
-  DACB.CH0DATA = output;
-  output = SILENCE;
+// The DMA channel whose buffer is playing, or finished playing if its
+// interrupt is pending, and the sample time its block started at. See
+// getSampleTime().
+volatile byte playingChannel = 0;
+volatile uint32_t playingBlockTime = -2 * AUDIO_BLOCK_SIZE;
 
-  int mix;
-  int sum = 0;
+ISR(DMA_CH0_vect) {
+  renderBlock(0);
+}
 
-  note_t *n;
-  for(byte i=0;i<MAX_NOTES;i++) {
-    n = &note[i];
-    if (n->midiVal != NOTE_OFF) {
-      if (n->waveformBuf != NULL) {
-	n->phase += n->phaseInc;
-	last = n->phaseFraction;
-	n->phaseFraction += n->phaseFractionInc;
-	if (n->phaseFraction < last) {
-	  // overflow in pseudo-floating point counter
-	  n->phase++;
-	}
-	if (!n->isSample) {
-	  if (n->phase >= N_WAVEFORM_SAMPLES) {
-	    if (n->midiVal != NOTE_PENDING_OFF) {
-	      n->phase -= N_WAVEFORM_SAMPLES;
-	      // don't assign volume until we cross zero
-	      n->volume = n->volumeNext;
-	    } else {
-	      n->midiVal = NOTE_OFF;
-	      continue;
-	    }
-	  }
-	} else {
-	  if ((n->phase >= n->sampleLength) || (n->midiVal == NOTE_PENDING_OFF)) {
-	    n->midiVal = NOTE_OFF;
-	    n->envelopePhase = OFF;
-	    continue;
-	  }
-	}
-	mix = pgm_read_word(n->waveformBuf + n->phase);
+ISR(DMA_CH1_vect) {
+  renderBlock(1);
+}
+
+// Scale a sample by a volume of 0..MAX_NOTE_VOL, returning (v * gain) >> 8.
+// The 16x8 product is built from the hardware multiplier: mul on the low
+// byte and mulsu on the signed high byte, 9 cycles for any gain. The shift
+// and add switch this replaced took about 10 cycles to dispatch plus 4 to
+// 35 cycles for the level, and only had 65 levels.
+static inline int scaleVolume(int v, byte gain) {
+  int result;
+  byte lowProduct;
+  asm (
+    "mul %A2, %3" "\n\t"
+    "mov %1, r1" "\n\t"
+    "mulsu %B2, %3" "\n\t"
+    "movw %0, r0" "\n\t"
+    "clr r1" "\n\t"
+    "add %A0, %1" "\n\t"
+    "adc %B0, r1" "\n\t"
+    : "=&r" (result), "=&r" (lowProduct)
+    : "a" (v), "a" (gain)
+  );
+  return result;
+}
+
+// The full product v * gain of a voice sample and its volume, as added to
+// the mix bus. Keeping all 24 bits means quiet voices keep their low bits
+// instead of losing them to a shift per voice. 10 cycles.
+static inline mix_t mixProduct(int v, byte gain) {
+  mix_t result;
+  asm (
+    "mulsu %B1, %2" "\n\t"
+    "mov %B0, r0" "\n\t"
+    "mov %C0, r1" "\n\t"
+    "mul %A1, %2" "\n\t"
+    "mov %A0, r0" "\n\t"
+    "add %B0, r1" "\n\t"
+    "clr r1" "\n\t"
+    "adc %C0, r1" "\n\t"
+    : "=&r" (result)
+    : "a" (v), "a" (gain)
+  );
+  return result;
+}
+
+// (v * gain) >> 8 for a mix bus value, 16 cycles.
+static inline mix_t scaleMix(mix_t v, byte gain) {
+  mix_t result;
+  byte zero;
+  asm (
+    "clr %1" "\n\t"
+    "mulsu %C2, %3" "\n\t"
+    "mov %B0, r0" "\n\t"
+    "mov %C0, r1" "\n\t"
+    "mul %B2, %3" "\n\t"
+    "mov %A0, r0" "\n\t"
+    "add %B0, r1" "\n\t"
+    "adc %C0, %1" "\n\t"
+    "mul %A2, %3" "\n\t"
+    "add %A0, r1" "\n\t"
+    "adc %B0, %1" "\n\t"
+    "adc %C0, %1" "\n\t"
+    "clr r1" "\n\t"
+    : "=&r" (result), "=&r" (zero)
+    : "a" (v), "a" (gain)
+  );
+  return result;
+}
+
+// Render state of a voice. It belongs to the output ISR: the control code
+// keeps its own copy of these values in note[] and sends changes with
+// voice commands, so the ISR never sees a half written field.
+typedef struct {
+  uint32_t phase;    // 16.16 fixed point position in the waveform
+  uint32_t phaseInc;
+  uint32_t phaseEnd;
+  uint32_t notePhaseInc; // phaseInc before the pitch routes, see modulateVoice()
+  const int16_t *waveformBuf;
+  byte kernel;
+  byte pan;          // see panVoice()
+  byte notePan;      // pan before the pan routes
+  int8_t modVelocity; // voice sources of the modulation matrix
+  int8_t modKey;
+  int8_t modCutoff;  // voice filter cutoff routes, added by setVoiceFilter()
+  byte filterCutoff; // voice filter, VOICE_FILTER_OFF for none, see setVoiceFilter()
+  byte filterEnvelope;
+  byte filterK;      // one pole coefficient for the block, of 256
+  int filterOut;     // last filter output, at half scale
+  byte volumeNext;   // envelope volume the gain ramps to over the block
+  unsigned int gain; // 8.8 fixed point volume, stepped every sample
+  int gainStep;
+  boolean pendingOff; // ramp to zero and end the voice at the end of the block
+  boolean fading;     // fading out because a new note is waiting for the voice
+  unsigned int fadeGain; // 8.8 fixed point volume during the fade
+  unsigned int fadeStep;
+  int lastOutput;
+  uint16_t noiseState; // xorshift generator of a noise voice, see noiseSample()
+  int noiseFilter[3];  // coloring filter state of a noise voice
+  byte startOffset;  // sample of the block the voice starts at
+  boolean startDeferred;
+  voiceCommand_t deferredStart; // start to apply at its startTime, see startDueVoices()
+  // envelope, see advanceEnvelope()
+  byte envelopePhase;
+  unsigned int envelopeIndex; // 8.8 fixed point index into the contour of the phase
+  unsigned int envelopeInc;   // steps per block, 0 to jump to the target
+  byte envelopeTarget;
+  byte sustainIndex;
+  unsigned int decayInc;
+  byte volumeScale;
+  boolean releaseDeferred;
+  boolean released;
+  unsigned int releaseValue;
+  uint32_t releaseTime;
+} voice_t;
+
+voice_t voice[MAX_NOTES];
+
+// Voice commands travel from the control code to the output ISR in
+// single-producer, single-consumer rings, one per producer: voiceQueue[0]
+// for the main loop and voiceQueue[1] for the low level interrupts that
+// run the sequencer and arpeggiator. The producer only writes head and the
+// ISR only writes tail. Both producers can command the same voice, so
+// each command is numbered from voiceCommandSeq as it is queued, and the
+// ISR applies the two queues merged in that order.
+typedef struct {
+  voiceCommand_t cmd[VOICE_QUEUE_SIZE];
+  volatile byte head;
+  volatile byte tail;
+} voiceQueue_t;
+
+voiceQueue_t voiceQueue[2];
+byte voiceCommandSeq = 0;
+
+// Samples rendered since power up
+volatile uint32_t sampleCount = 0;
 
+// Voice render kernels.
+// Every kernel is an instance of renderVoice() for one voice type, so the
+// tests on the voice type are resolved at compile time and the per-sample
+// loop only contains the work for that type. The kernel for a voice is
+// chosen by selectKernel() when the note is started or its waveform changes.
+// A kernel mixes up to count samples of the voice into mix[] and returns
+// the number of samples it produced before the voice ended. count is less
+// than AUDIO_BLOCK_SIZE in the block where a voice starts part way through.
+//
+// Approximate cost per sample, counted from the instruction sequence of
+// the inner loop (the debug build measures the real numbers, see
+// kernelCycles[]), including mixProduct() and the 24 bit add to mix[].
+//
+//   kernel                 cycles/sample   notes
+//   KERNEL_WAVETABLE       ~43             phase add, index mask, lpm, gain step, scale, mix
+//   KERNEL_SAMPLE          ~48             phase add, end test, lpm, gain step, scale, mix
+//   KERNEL_NOISE           ~30-55          phase add, new value at each carry
+//   KERNEL_NOISE_PINK      ~30-100         as above, three one pole filters per value
+//   KERNEL_NOISE_BROWN     ~30-70          as above, a leaky integrator per value
+//   KERNEL_WAVETABLE_LERP  ~68             + next entry, difference, 16x8 blend
+//   KERNEL_SAMPLE_LERP     ~73             as above
+//
+// The noise kernels cost the most at the top of the range, where they
+// draw a new value every sample.
+//
+// A voice of a channel with voice filters (settings_t.voiceFilterCutoff)
+// runs the filtered instance of its kernel, which passes each sample
+// through a one pole low pass filter, filterVoiceSample(), for about 20
+// cycles per sample more, so a filtered wavetable voice costs about 63
+// cycles per sample against 43. While a channel has voice filters the
+// polyphony comes down to fit the higher cost (see updateVoiceLimit()).
+//
+// The interpolating kernels blend each table entry with the next one by
+// the phase fraction. They cost about 25 cycles per sample more than the
+// plain kernels, so a channel that uses them costs roughly one and a
+// half voices per note.
+//
+// With the old adjustAmplitude() switch the first two were 45 to 75
+// cycles per sample depending on the volume level.
+//
+// Every kernel steps the voice gain by gainStep each sample, a straight
+// line to the envelope volume over the block (see rampGain()). A volume
+// change or a stop is heard right away without a click, where it used to
+// wait for the end of the waveform cycle, up to one period of the note.
+//
+// The modulation matrix costs nothing here. Its voice destinations are
+// applied once per block by modulateVoice(), about 40 cycles per route
+// and another 100 or so for a voice with pitch routes.
+//
+// While the pitch LFO is on, the wavetable and noise kernels add it to
+// their phase increment every sample (see advanceLFOs()), a 16x16
+// multiply and add of about 20 cycles per sample, so a wavetable voice
+// costs about 63 cycles per sample instead of 43.
+//
+// A stolen voice is rendered by fadeVoice() instead for the
+// STEAL_FADE_SAMPLES it takes to fade out, at about 80 cycles per sample.
+//
+// With STEREO_OUTPUT a voice that is not at the center costs about 70
+// cycles per sample more: it is rendered into its own buffer, which
+// panVoice() scales into the left and right buses. Voices at the center
+// are panned together at the end, so they cost nothing extra.
+//
+// The output stage (headroom gain, filter, soft clip, dither) takes
+// about 150 cycles per sample with the filter on and 90 with it off,
+// against about 70 and 20 for the 16 bit bus with a hard clip it
+// replaced. With STEREO_OUTPUT it runs once per channel, plus the
+// center bus. The debug build counts the panning
+// in kernelCycles[] and the output stage in outputCycles.
+//
+// The output timer period is 1280 cycles per sample at 25KHz, 2000 at
+// 16KHz and 1000 at 32KHz (see setOutputRate()), so the lower rate has
+// about one and a half times the rendering time per sample.
+
+static inline boolean isSampleKernel(byte kernel) {
+  return (kernel == KERNEL_SAMPLE) || (kernel == KERNEL_SAMPLE_LERP);
+}
+
+// The waveform value at phase. Without interpolation this is the table
+// entry the phase points into. With it, the next entry is weighted by
+// the top 8 bits of the phase fraction, using the same multiply as
+// scaleVolume(). wrap masks the index for single cycle waveforms. A
+// sample that is interpolated ends one entry early (see startVoice()),
+// so its next entry is always inside the sample.
+template <boolean lerp, boolean wrap>
+static inline int tableSample(const int16_t *buf, uint32_t phase) {
+  unsigned int index = phase >> PHASE_FRACTION_BITS;
+  if (wrap) {
+    index &= WAVEFORM_INDEX_MASK;
+  }
+  int s0 = pgm_read_word(buf + index);
+  if (!lerp) {
+    return s0;
+  }
+  index++;
+  if (wrap) {
+    index &= WAVEFORM_INDEX_MASK;
+  }
+  int s1 = pgm_read_word(buf + index);
+  return s0 + scaleVolume(s1 - s0, (byte)(phase >> (PHASE_FRACTION_BITS - 8)));
+}
+
+// lfoPitchMod[] from the first sample of the voice being rendered, or
+// NULL when the pitch LFO is off. Set by renderBlock() for each voice.
+static const int *voicePitchMod;
+
+// The phase increment is taken down by PITCH_MOD_SHIFT bits to multiply
+// it by the pitch LFO in 16 bits. Wavetable increments stay below 2^25
+// up to MIDI_HIGH at 16KHz, so the shifted increment fits in an int.
+#define PITCH_MOD_SHIFT 10
+
+// One pole low pass filter on the samples of a voice:
+// y += (x - y) * k / 256. It runs at half scale, so the difference
+// always fits in an int.
+static inline int filterVoiceSample(int x, int *y, byte k) {
+  *y += scaleVolume((x >> 1) - *y, k);
+  return *y << 1;
+}
+
+static inline boolean isNoiseKernel(byte kernel) {
+  return (kernel == KERNEL_NOISE) || (kernel == KERNEL_NOISE_PINK) || (kernel == KERNEL_NOISE_BROWN);
+}
+
+// The next value of a noise voice, -1024..1023 for white noise: a step
+// of its 16 bit xorshift generator, as ditherNoise() uses, which repeats
+// after 65535 values. The pink kernel passes it through Paul Kellet's
+// economy pink filter with the poles and gains taken to powers of two,
+// which stays within a dB or so of -3dB per octave from 50Hz to 10KHz
+// when a value is drawn every sample. The brown kernel integrates it,
+// with a leak that flattens the spectrum below about 60Hz so it does
+// not wander off. Both come out at about the RMS level of white noise.
+template <byte kernel>
+static inline int noiseSample(uint16_t *state, int *b) {
+  uint16_t x = *state;
+  x ^= x << 7;
+  x ^= x >> 9;
+  x ^= x << 8;
+  *state = x;
+  int w = (int)x >> 5;
+  if (kernel == KERNEL_NOISE_PINK) {
+    b[0] += (w >> 4) - (b[0] >> 9);
+    b[1] += (w >> 2) - (b[1] >> 5);
+    b[2] += w - (b[2] >> 1);
+    return (b[0] + b[1] + (b[2] >> 1) + (w >> 2)) >> 1;
+  }
+  if (kernel == KERNEL_NOISE_BROWN) {
+    b[0] += (w >> 2) - (b[0] >> 6);
+    return (b[0] >> 1) + (b[0] >> 2);
+  }
+  return w;
+}
+
+template <byte kernel, boolean filter>
+byte renderVoice(voice_t *v, mix_t *mix, byte count) {
+  byte s;
+  unsigned int gain = v->gain;
+  int gainStep = v->gainStep;
+  int filterOut = v->filterOut;
+  byte filterK = v->filterK;
+
+  if (isNoiseKernel(kernel)) {
+    // Sample and hold: a new value each time the 16 bit phase carries,
+    // so the noise follows the pitch of the note (see setPhaseIncrement()).
+    int lastOutput = v->lastOutput;
+    unsigned int phase = v->phase;
+    unsigned int phaseInc = v->phaseInc;
+    uint16_t noiseState = v->noiseState;
+    const int *pitchMod = voicePitchMod;
+    for(s=0;s<count;s++) {
+      unsigned int lastPhase = phase;
+      if (pitchMod != NULL) {
+	// the pitch LFO, as for the wavetable kernels below, up to a new
+	// value every sample
+	long inc = phaseInc + (((long)phaseInc * pitchMod[s]) >> 14);
+	phase += (inc > NOISE_MAX_INC) ? NOISE_MAX_INC : inc;
       } else {
-	if (n->midiVal != NOTE_PENDING_OFF) {
-	  n->volume = n->volumeNext;
-	} else {
-	  n->midiVal = NOTE_OFF;
-	  continue;
+	phase += phaseInc;
+      }
+      if (phase < lastPhase) {
+	lastOutput = noiseSample<kernel>(&noiseState, v->noiseFilter);
+      }
+      int x = lastOutput;
+      if (filter) {
+	x = filterVoiceSample(x, &filterOut, filterK);
+      }
+      gain += gainStep;
+      mix[s] += mixProduct(x, gain >> 8);
+    }
+    v->lastOutput = lastOutput;
+    v->phase = phase;
+    v->noiseState = noiseState;
+    v->filterOut = filterOut;
+    v->gain = gain;
+    return count;
+  }
+
+  const boolean sample = (kernel == KERNEL_SAMPLE) || (kernel == KERNEL_SAMPLE_LERP);
+  const boolean lerp = (kernel == KERNEL_WAVETABLE_LERP) || (kernel == KERNEL_SAMPLE_LERP);
+
+  // A wavetable phase runs freely and the table index is masked out of
+  // it. The 32 bit phase holds a whole number of cycles, so it can
+  // overflow as well. A sample ends when its phase reaches phaseEnd.
+  const int16_t *waveformBuf = v->waveformBuf;
+  uint32_t phase = v->phase;
+  uint32_t phaseInc = v->phaseInc;
+  uint32_t phaseEnd = v->phaseEnd;
+
+  if ((!sample) && (voicePitchMod != NULL)) {
+    // The pitch LFO at audio rate, one multiply and add per sample:
+    // the increment grows by phaseInc * lfoPitchMod[s] >> 14.
+    const int *pitchMod = voicePitchMod;
+    int incHigh = phaseInc >> PITCH_MOD_SHIFT;
+    for(s=0;s<count;s++) {
+      phase += phaseInc + (((long)incHigh * pitchMod[s]) >> (14 - PITCH_MOD_SHIFT));
+      int x = tableSample<lerp, true>(waveformBuf, phase);
+      if (filter) {
+	x = filterVoiceSample(x, &filterOut, filterK);
+      }
+      gain += gainStep;
+      mix[s] += mixProduct(x, gain >> 8);
+    }
+    v->phase = phase;
+    v->filterOut = filterOut;
+    v->gain = gain;
+    return count;
+  }
+
+  for(s=0;s<count;s++) {
+    phase += phaseInc;
+    if ((sample) && (phase >= phaseEnd)) {
+      break;
+    }
+    int x = tableSample<lerp, !sample>(waveformBuf, phase);
+    if (filter) {
+      x = filterVoiceSample(x, &filterOut, filterK);
+    }
+    gain += gainStep;
+    mix[s] += mixProduct(x, gain >> 8);
+  }
+  v->phase = phase;
+  v->filterOut = filterOut;
+  v->gain = gain;
+  return s;
+}
+
+// Render a voice that was stolen while its volume ramps down to zero over
+// STEAL_FADE_SAMPLES. Returns the number of samples mixed before the ramp
+// reached zero. This only runs for one block or so per steal, so it is a
+// plain loop for all voice types rather than a kernel per type.
+byte fadeVoice(voice_t *v, mix_t *mix, byte count) {
+  byte s;
+  int sample = v->lastOutput;
+  for(s=0;s<count;s++) {
+    if (v->fadeGain <= v->fadeStep) {
+      break;
+    }
+    v->fadeGain -= v->fadeStep;
+    if (!isNoiseKernel(v->kernel)) {
+      // noise holds its last value for the short fade
+      v->phase += v->phaseInc;
+      unsigned int index = v->phase >> PHASE_FRACTION_BITS;
+      if (isSampleKernel(v->kernel)) {
+	if (v->phase >= v->phaseEnd) {
+	  break;
 	}
-	unsigned int rand = noiseBuf[noiseBufIndex];
-	noiseBufIndex = (noiseBufIndex + 1) % NOISE_BUF_LEN;
-	// use a data point in the random number stream
-	// to determine if the output should change.
-	// The probability of the output change is in n->phase.
-	if ((rand+1024) <= n->phaseInc) {
-	  mix = noiseBuf[noiseBufIndex];
-	  n->lastOutput = mix;
-	} else {
-	  mix = n->lastOutput;
+      } else {
+	index &= WAVEFORM_INDEX_MASK;
+      }
+      sample = pgm_read_word(v->waveformBuf + index);
+    }
+    int x = sample;
+    if (v->filterCutoff != VOICE_FILTER_OFF) {
+      x = filterVoiceSample(x, &v->filterOut, v->filterK);
+    }
+    mix[s] += mixProduct(x, v->fadeGain >> 8);
+  }
+  return s;
+}
+
+typedef byte (*renderKernel_t)(voice_t *, mix_t *, byte);
+
+// Indexed by voice_t.kernel
+const renderKernel_t renderKernels[N_KERNELS] = {
+  renderVoice<KERNEL_WAVETABLE, false>,
+  renderVoice<KERNEL_SAMPLE, false>,
+  renderVoice<KERNEL_NOISE, false>,
+  renderVoice<KERNEL_WAVETABLE_LERP, false>,
+  renderVoice<KERNEL_SAMPLE_LERP, false>,
+  renderVoice<KERNEL_NOISE_PINK, false>,
+  renderVoice<KERNEL_NOISE_BROWN, false>
+};
+
+// The kernels for voices with a voice filter
+const renderKernel_t filteredRenderKernels[N_KERNELS] = {
+  renderVoice<KERNEL_WAVETABLE, true>,
+  renderVoice<KERNEL_SAMPLE, true>,
+  renderVoice<KERNEL_NOISE, true>,
+  renderVoice<KERNEL_WAVETABLE_LERP, true>,
+  renderVoice<KERNEL_SAMPLE_LERP, true>,
+  renderVoice<KERNEL_NOISE_PINK, true>,
+  renderVoice<KERNEL_NOISE_BROWN, true>
+};
+
+// Highest measured cost of each kernel in cycles per sample (debug builds only)
+volatile unsigned int kernelCycles[N_KERNELS];
+volatile unsigned int filteredKernelCycles[N_KERNELS];
+
+// Highest measured cost of the output stage, the filter, clipping and
+// panning of the mix, in cycles per sample (debug builds only)
+volatile unsigned int outputCycles;
+
+// Choose the render kernel that matches the waveform of note i, and
+// the interpolation and noise color settings of its channel.
+void selectKernel(byte i) {
+  note_t *n = &note[i];
+  byte channel = n->midiChannel & 0x7F;
+  settings_t *s = ((channel >= 1) && (channel <= N_SETTINGS)) ? &settings[channel-1] : NULL;
+  boolean lerp = (s != NULL) && (s->interpolate);
+  if (n->waveformBuf == NULL) {
+    byte color = (s != NULL) ? s->noiseColor : NOISE_WHITE;
+    if (color == NOISE_PINK) {
+      n->kernel = KERNEL_NOISE_PINK;
+    } else if (color == NOISE_BROWN) {
+      n->kernel = KERNEL_NOISE_BROWN;
+    } else {
+      n->kernel = KERNEL_NOISE;
+    }
+  } else {
+    if (n->isSample) {
+      n->kernel = (lerp) ? KERNEL_SAMPLE_LERP : KERNEL_SAMPLE;
+    } else {
+      n->kernel = (lerp) ? KERNEL_WAVETABLE_LERP : KERNEL_WAVETABLE;
+    }
+  }
+}
+
+// Packed list of the voices that are sounding. renderBlock() only visits
+// these, so idle voices cost nothing. Bit i of activeVoiceMask is set while
+// voice i is in the list. Only the output ISR changes the list: a voice is
+// added when its start command is applied and removed when it ends.
+volatile byte activeVoices[MAX_NOTES];
+volatile byte nActiveVoices = 0;
+volatile byte activeVoiceMask = 0;
+
+// The startCount of the last start command applied to each voice, so the
+// control code can tell a voice that ended from one that has not started.
+volatile byte voiceStartCount[MAX_NOTES];
+
+// Longest time in samples from a note on request to its voice starting
+// (debug builds only). Before voices were stolen with a fade, the control
+// code waited for the stolen voice to end its waveform cycle, up to one
+// period of the lowest note (about 900 samples at MIDI_LOW). Now the wait
+// is at most a block for the queue plus STEAL_FADE_SAMPLES, plus the time
+// until loop() sets the pitch of the note. Notes from MIDI are started
+// MIDI_LATENCY after they arrive instead, so they measure about that.
+volatile unsigned int maxNoteOnLatency = 0;
+
+// Queue a command for voice i, taking its arguments from note[i].
+// Returns false if the queue is full. Parameter updates may not use the
+// last VOICE_QUEUE_RESERVE slots, so note events always find room.
+boolean sendVoiceCommand(byte type, byte i) {
+  // Low level interrupts do not nest, and the main loop cannot run while
+  // one is executing, so each queue only ever has one producer at a time.
+  voiceQueue_t *q = &voiceQueue[(PMIC.STATUS & PMIC_LOLVLEX_bm) ? 1 : 0];
+  byte head = q->head;
+  byte used = (head - q->tail) & (VOICE_QUEUE_SIZE - 1);
+  byte limit = VOICE_QUEUE_SIZE - 1;
+  if ((type == VOICE_CMD_SET_INC) || (type == VOICE_CMD_SET_GAIN) || (type == VOICE_CMD_SET_WAVEFORM)) {
+    limit -= VOICE_QUEUE_RESERVE;
+  }
+  if (used >= limit) {
+    return false;
+  }
+
+  note_t *n = &note[i];
+  voiceCommand_t *c = &q->cmd[head];
+  c->type = type;
+  c->voice = i;
+  c->value = n->phaseInc;
+  c->volumeScale = n->volumeScale;
+  c->waveformBuf = n->tableBuf;
+  switch (type) {
+  case VOICE_CMD_START:
+    c->kernel = n->kernel;
+    c->velocity = ((unsigned int)n->velocity * 127) / MAX_VELOCITY;
+    c->key = n->midiVal;
+    c->startCount = ++n->startCount;
+    c->sampleLength = n->sampleLength;
+    c->startTime = n->startTime;
+    c->pan = n->pan;
+    c->filterCutoff = n->filterCutoff;
+    c->filterEnvelope = n->filterEnvelope;
+    c->peakIndex = n->peakIndex;
+    if (n->isSample) {
+      // samples play at the peak volume until they are released
+      c->sustainIndex = n->peakIndex;
+      c->attackInc = 0;
+    } else {
+      c->sustainIndex = n->sustainIndex;
+      c->attackInc = n->attackInc;
+    }
+    c->decayInc = n->decayInc;
+#ifdef DEBUG_ENABLE
+    c->requestTime = n->requestTime;
+#endif
+    break;
+  case VOICE_CMD_RELEASE:
+    c->value = n->releaseValue;
+    c->startTime = n->releaseTime;
+    break;
+  case VOICE_CMD_SET_WAVEFORM:
+    c->kernel = n->kernel;
+    c->sampleLength = n->sampleLength;
+    break;
+  }
+  // The command has to be complete in memory before the ISR can see it.
+  // The sequencer interrupt can queue commands in the middle of a main
+  // loop call, so the number and the head are set together.
+  asm volatile("" ::: "memory");
+  byte oldSREG = SREG;
+  cli();
+  c->seq = voiceCommandSeq++;
+  q->head = (head + 1) & (VOICE_QUEUE_SIZE - 1);
+  SREG = oldSREG;
+  return true;
+}
+
+uint32_t getSampleCount() {
+  byte oldSREG = SREG;
+  cli();
+  uint32_t count = sampleCount;
+  SREG = oldSREG;
+  return count;
+}
+
+// Sample time of the next sample to reach the DAC, counted like
+// sampleCount. The block being rendered next plays two blocks after the
+// one that is playing, so the playing block starts 2 * AUDIO_BLOCK_SIZE
+// behind sampleCount, and the DMA transfer count of the playing channel
+// gives the position inside the block. This is also called from the
+// serial receive interrupt, which can preempt renderBlock(), so it goes
+// by playingBlockTime, which changes together with playingChannel,
+// rather than by sampleCount, which only moves at the end of the block.
+uint32_t getSampleTime() {
+  byte oldSREG = SREG;
+  cli();
+  uint32_t time = playingBlockTime;
+  DMA_CH_t *playing = (playingChannel == 0) ? &DMA.CH0 : &DMA.CH1;
+  DMA_CH_t *next = (playingChannel == 0) ? &DMA.CH1 : &DMA.CH0;
+  boolean done;
+  byte remaining;
+  do {
+    // If the block ended and its interrupt has not run yet, the other
+    // channel is playing the block after it. Read again if the block
+    // ended while the transfer count was being read.
+    done = (playing->CTRLB & DMA_CH_TRNIF_bm) != 0;
+    remaining = (done ? next : playing)->TRFCNT / AUDIO_FRAME_BYTES;
+  } while (done != ((playing->CTRLB & DMA_CH_TRNIF_bm) != 0));
+  SREG = oldSREG;
+  if (done) {
+    time += AUDIO_BLOCK_SIZE;
+  }
+  return time + AUDIO_BLOCK_SIZE - remaining;
+}
+
+// Hold the DAC at the sample it is at for a section that runs with
+// interrupts disabled for a long time, like the EEPROM access in
+// eeprom.cpp. The DMA keeps replaying audioBuf[] while the render ISR
+// can't run, which would turn the two stale blocks into a loud buzz, so
+// both are filled with that sample. Call it with interrupts disabled;
+// rendering picks up again when they are enabled.
+void holdAudio() {
+  uint16_t left = DACB.CH0DATA;
+#ifdef STEREO_OUTPUT
+  uint16_t right = DACB.CH1DATA;
+#endif
+  for(byte b=0;b<2;b++) {
+    uint16_t *buf = audioBuf[b];
+    for(byte s=0;s<AUDIO_BLOCK_SIZE;s++) {
+      *buf++ = left;
+#ifdef STEREO_OUTPUT
+      *buf++ = right;
+#endif
+    }
+  }
+}
+
+// Bytes received on the MIDI port are stamped with the low bits of the
+// sample time, see midiEventTime(). The receive interrupt runs above the
+// render ISR, so the stamp is taken within the time of a character.
+uint16_t serialRxTime() {
+  return getSampleTime();
+}
+
+// One pole coefficient of the voice filter for each cutoff, of 256:
+// 1 - exp(-2 pi fc / 25000), with fc going from 30Hz up to about 6KHz in
+// equal steps of pitch like svfFrequency[]. The low cutoffs step
+// coarsely, the price of an 8 bit coefficient.
+const byte voiceFilterCoefficient[256] PROGMEM = {
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7,
+  7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 10, 10,
+  10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14,
+  14, 14, 15, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 19, 19,
+  19, 20, 20, 21, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26,
+  27, 27, 28, 28, 29, 29, 30, 31, 31, 32, 32, 33, 34, 34, 35, 36,
+  36, 37, 38, 39, 39, 40, 41, 42, 43, 43, 44, 45, 46, 47, 48, 49,
+  49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 60, 61, 62, 63, 64, 65,
+  66, 68, 69, 70, 71, 73, 74, 75, 76, 78, 79, 81, 82, 83, 85, 86,
+  88, 89, 91, 92, 94, 95, 97, 98, 100, 102, 103, 105, 107, 108, 110, 112,
+  114, 115, 117, 119, 121, 122, 124, 126, 128, 130, 132, 134, 136, 137, 139, 141,
+  143, 145, 147, 149, 151, 153, 155, 157, 159, 161, 163, 165, 167, 169, 171, 173,
+  175, 177, 178, 180, 182, 184, 186, 188, 190, 192, 194, 195, 197, 199, 201, 203
+};
+
+// Set the voice filter coefficient of voice v for the next block. The
+// envelope level opens the filter from its key tracked cutoff by
+// filterEnvelope, and the coefficient is scaled from 25KHz to the
+// output rate. The cutoff routes of the modulation matrix move it too.
+static void setVoiceFilter(voice_t *v, byte level) {
+  int cutoff = v->filterCutoff + (((unsigned int)level * v->filterEnvelope) >> 8) + v->modCutoff;
+  cutoff = constrain(cutoff, 0, 255);
+  unsigned int k = ((uint32_t)pgm_read_byte(&voiceFilterCoefficient[cutoff]) * envelopeRateScale) >> 8;
+  v->filterK = (k > 255) ? 255 : k;
+}
+
+// Apply the voice destinations of the modulation matrix to voice v for
+// the next block, with its envelope at level. The pitch routes scale
+// the phase increment of the note by up to an octave, pitchRatio() of
+// 24 steps of pitch per step of the sum.
+static void modulateVoice(voice_t *v, byte level) {
+  int8_t envelope = level >> 1;
+  int sum;
+  if (nModRoutes[MOD_DST_AMPLITUDE] != 0) {
+    sum = modulation(MOD_DST_AMPLITUDE, envelope, v->modVelocity, v->modKey);
+    sum = constrain(sum, -128, 127);
+    unsigned int volume = ((unsigned int)v->volumeNext * (128 + sum)) >> 7;
+    v->volumeNext = (volume > MAX_NOTE_VOL) ? MAX_NOTE_VOL : volume;
+  }
+  uint32_t inc = v->notePhaseInc;
+  if (nModRoutes[MOD_DST_PITCH] != 0) {
+    sum = modulation(MOD_DST_PITCH, envelope, v->modVelocity, v->modKey);
+    uint32_t ratio = pitchRatio(sum * 24);
+    // inc * ratio >> 14 without overflowing 32 bits
+    inc = (((inc >> 16) * ratio) << 2) + (((inc & 0xFFFF) * ratio) >> 14);
+    if ((isNoiseKernel(v->kernel)) && (inc > NOISE_MAX_INC)) {
+      inc = NOISE_MAX_INC;
+    }
+  }
+  v->phaseInc = inc;
+#ifdef STEREO_OUTPUT
+  if (nModRoutes[MOD_DST_PAN] != 0) {
+    sum = v->notePan + modulation(MOD_DST_PAN, envelope, v->modVelocity, v->modKey);
+    v->pan = constrain(sum, PAN_LEFT, PAN_RIGHT);
+  } else {
+    v->pan = v->notePan;
+  }
+#endif
+  if ((v->filterCutoff != VOICE_FILTER_OFF) && (nModRoutes[MOD_DST_VOICE_CUTOFF] != 0)) {
+    sum = modulation(MOD_DST_VOICE_CUTOFF, envelope, v->modVelocity, v->modKey);
+    v->modCutoff = constrain(sum, -128, 127);
+  } else {
+    v->modCutoff = 0;
+  }
+}
+
+// The volume of the envelope of voice v, scaled by the track fader.
+static void setEnvelopeVolume(voice_t *v) {
+  byte level = 0;
+  byte index = v->envelopeIndex >> 8;
+  if (v->envelopePhase == ATTACK) {
+    level = pgm_read_byte(&attackLogVolume[index]);
+  } else if (v->envelopePhase != OFF) {
+    level = pgm_read_byte(&logVolume[index]);
+  }
+  v->volumeNext = ((unsigned int)level * (v->volumeScale + 1)) >> 8;
+  modulateVoice(v, level);
+  if (v->filterCutoff != VOICE_FILTER_OFF) {
+    setVoiceFilter(v, level);
+  }
+}
+
+// Set the gain step of voice v for the next n samples: a straight line
+// from its gain to the envelope volume, or to zero when the voice is
+// stopping. The division rounds toward zero, so the gain never passes
+// the target, and what is left over is taken up by the next block. The
+// step of a short ramp may not fit in an int, but the gain is stepped
+// modulo 65536 and stays in range, so it still lands in the right place.
+static void rampGain(voice_t *v, byte n) {
+  unsigned int target = (v->pendingOff) ? 0 : ((unsigned int)v->volumeNext << 8);
+  long delta = (long)target - v->gain;
+  if (n == AUDIO_BLOCK_SIZE) {
+    // the usual case, without a division routine
+    v->gainStep = delta / AUDIO_BLOCK_SIZE;
+  } else {
+    v->gainStep = delta / n;
+  }
+}
+
+// Leave the attack at the current volume, decaying to the sustain level
+// if it is lower. The attack has its own contour, so the index moves to
+// the same volume on the logVolume[] contour.
+static void endAttack(voice_t *v) {
+  byte level = pgm_read_byte(&attackLogVolume[v->envelopeIndex >> 8]);
+  v->envelopeIndex = (unsigned int)pgm_read_byte(&inverseLogVolume[level]) << 8;
+  if (v->sustainIndex >= (v->envelopeIndex >> 8)) {
+    v->envelopePhase = SUSTAIN;
+  } else {
+    v->envelopePhase = DECAY;
+    v->envelopeTarget = v->sustainIndex;
+    v->envelopeInc = v->decayInc;
+  }
+}
+
+static void releaseVoice(voice_t *v) {
+  v->released = true;
+  if (isSampleKernel(v->kernel)) {
+    // shorten a sample to releaseValue/256 of what it has left to play
+    if (v->releaseValue < 256) {
+      v->phaseEnd = v->phase + ((v->phaseEnd - v->phase) >> 8) * v->releaseValue;
+    }
+    return;
+  }
+  if (v->envelopePhase == OFF) {
+    return;
+  }
+  if (v->envelopePhase == ATTACK) {
+    endAttack(v);
+  }
+  v->envelopePhase = RELEASE;
+  v->envelopeTarget = 0;
+  v->envelopeInc = v->releaseValue;
+}
+
+// Advance the envelope of voice v by the block that starts at sample time
+// t, and set the volume the block is rendered at. Each phase moves along
+// its contour by a fixed number of steps per block, so envelope times do
+// not depend on how busy the main loop is. A release that is due in the
+// block starts first. The voice ends when the release reaches zero.
+void advanceEnvelope(voice_t *v, uint32_t t) {
+  if ((v->releaseDeferred) && ((int32_t)(v->releaseTime - t) < AUDIO_BLOCK_SIZE)) {
+    v->releaseDeferred = false;
+    releaseVoice(v);
+  }
+  byte phase = v->envelopePhase;
+  if ((phase == ATTACK) || (phase == DECAY) || (phase == RELEASE)) {
+    unsigned int index = v->envelopeIndex;
+    unsigned int target = (unsigned int)v->envelopeTarget << 8;
+    unsigned int inc = v->envelopeInc;
+    boolean done;
+    if (phase == ATTACK) {
+      done = (inc == 0) || (target - index <= inc);
+      index += inc;
+    } else {
+      done = (inc == 0) || (index - target <= inc);
+      index -= inc;
+    }
+    if (done) {
+      index = target;
+    }
+    v->envelopeIndex = index;
+    if (done) {
+      if (phase == ATTACK) {
+	endAttack(v);
+      } else if (phase == DECAY) {
+	v->envelopePhase = SUSTAIN;
+      } else {
+	v->envelopePhase = OFF;
+	v->pendingOff = true;
+      }
+    }
+  }
+  setEnvelopeVolume(v);
+}
+
+// The volume voice i is playing at, for the control code.
+byte voiceVolume(byte i) {
+  return voice[i].gain >> 8;
+}
+
+// Set up voice i to play the waveform of c: the kernel, the phase
+// increment and where a sample ends. Used by startVoice() and to change
+// the waveform of a voice that is playing, which keeps its phase so the
+// new waveform carries on without a click.
+static void setVoiceWaveform(byte i, voiceCommand_t *c) {
+  voice_t *v = &voice[i];
+  if ((!isSampleKernel(v->kernel)) && (isSampleKernel(c->kernel))) {
+    // a wavetable phase runs freely past the end of any sample, so only
+    // the position in the cycle is kept
+    v->phase &= ((uint32_t)N_WAVEFORM_SAMPLES << PHASE_FRACTION_BITS) - 1;
+  }
+  v->phaseInc = c->value;
+  v->notePhaseInc = c->value;
+  v->waveformBuf = c->waveformBuf;
+  v->kernel = c->kernel;
+  if (isNoiseKernel(c->kernel)) {
+    if (v->noiseState == 0) {
+      // the generator must not be 0, and the voices should not share a sequence
+      v->noiseState = ((uint16_t)sampleCount << 4) ^ (0xACE1 + i);
+      if (v->noiseState == 0) {
+	v->noiseState = 1;
+      }
+    }
+    v->noiseFilter[0] = 0;
+    v->noiseFilter[1] = 0;
+    v->noiseFilter[2] = 0;
+  }
+  if (c->kernel == KERNEL_SAMPLE) {
+    v->phaseEnd = (uint32_t)c->sampleLength << PHASE_FRACTION_BITS;
+  } else if (c->kernel == KERNEL_SAMPLE_LERP) {
+    // stop before the last entry, which has no next entry to blend with
+    v->phaseEnd = (uint32_t)(c->sampleLength - 1) << PHASE_FRACTION_BITS;
+  } else {
+    v->phaseEnd = (uint32_t)N_WAVEFORM_SAMPLES << PHASE_FRACTION_BITS;
+  }
+}
+
+void startVoice(byte i, voiceCommand_t *c, byte offset) {
+  voice_t *v = &voice[i];
+  v->phase = 0;
+  setVoiceWaveform(i, c);
+  v->pan = c->pan;
+  v->notePan = c->pan;
+  v->modVelocity = c->velocity;
+  v->modKey = constrain(((int)c->key - 60) * 2, -128, 127);
+  v->modCutoff = 0;
+  v->filterCutoff = c->filterCutoff;
+  v->filterEnvelope = c->filterEnvelope;
+  v->filterOut = 0;
+  v->volumeScale = c->volumeScale;
+  v->sustainIndex = c->sustainIndex;
+  v->decayInc = c->decayInc;
+  if (c->attackInc == 0) {
+    v->envelopePhase = DECAY; // start at the peak on the decay contour
+    v->envelopeIndex = (unsigned int)c->peakIndex << 8;
+    if (v->sustainIndex >= c->peakIndex) {
+      v->envelopePhase = SUSTAIN;
+    } else {
+      v->envelopeTarget = v->sustainIndex;
+      v->envelopeInc = v->decayInc;
+    }
+  } else {
+    v->envelopePhase = ATTACK;
+    v->envelopeIndex = 0;
+    v->envelopeTarget = pgm_read_byte(&inverseAttackLogVolume[pgm_read_byte(&logVolume[c->peakIndex])]);
+    v->envelopeInc = c->attackInc;
+  }
+  setEnvelopeVolume(v);
+  v->gain = (unsigned int)v->volumeNext << 8;
+  v->pendingOff = false;
+  v->fading = false;
+  v->released = false;
+  v->lastOutput = 0;
+  v->startOffset = offset;
+  v->startDeferred = false;
+  voiceStartCount[i] = c->startCount;
+#ifdef DEBUG_ENABLE
+  unsigned int latency = sampleCount + offset - c->requestTime;
+  if (latency > maxNoteOnLatency) {
+    maxNoteOnLatency = latency;
+  }
+#endif
+  if (!(activeVoiceMask & (1 << i))) {
+    activeVoiceMask |= (1 << i);
+    activeVoices[nActiveVoices++] = i;
+  }
+}
+
+void dropVoice(byte i) {
+  for(byte j=0;j<nActiveVoices;j++) {
+    if (activeVoices[j] == i) {
+      activeVoices[j] = activeVoices[--nActiveVoices];
+      break;
+    }
+  }
+  activeVoiceMask &= ~(1 << i);
+}
+
+void applyVoiceCommand(voiceCommand_t *c) {
+  byte i = c->voice;
+  voice_t *v = &voice[i];
+  boolean active = activeVoiceMask & (1 << i);
+  // Commands that follow a deferred start are meant for the new note.
+  voiceCommand_t *start = (v->startDeferred) ? &v->deferredStart : NULL;
+
+  switch (c->type) {
+  case VOICE_CMD_START:
+    // Every start waits for its start time, see startDueVoices().
+    if ((active) && (v->phaseInc == 0)) {
+      // a voice that does not move cannot be faded out
+      dropVoice(i);
+    }
+    v->deferredStart = *c;
+    v->startDeferred = true;
+    // a release for the note that is ending no longer matters
+    v->releaseDeferred = false;
+    break;
+  case VOICE_CMD_STOP:
+    v->startDeferred = false;
+    if (active) {
+      // ramped down over the next block, see rampGain()
+      v->pendingOff = true;
+    }
+    break;
+  case VOICE_CMD_RELEASE:
+    // applied by advanceEnvelope() in the block it is due in, which is
+    // after the start of a voice that has not started yet
+    v->releaseValue = c->value;
+    v->releaseTime = c->startTime;
+    v->releaseDeferred = true;
+    break;
+  case VOICE_CMD_SET_INC:
+    // the pitch may have moved to another mipmap level
+    if (start != NULL) {
+      start->value = c->value;
+      start->waveformBuf = c->waveformBuf;
+    } else {
+      // the pitch routes apply from the next block
+      v->phaseInc = c->value;
+      v->notePhaseInc = c->value;
+      v->waveformBuf = c->waveformBuf;
+    }
+    break;
+  case VOICE_CMD_SET_GAIN:
+    // the track fader, applied by the next advanceEnvelope()
+    if (start != NULL) {
+      start->volumeScale = c->volumeScale;
+    } else {
+      v->volumeScale = c->volumeScale;
+    }
+    break;
+  case VOICE_CMD_SET_WAVEFORM:
+    // the envelope carries on where it is
+    if (start != NULL) {
+      start->value = c->value;
+      start->waveformBuf = c->waveformBuf;
+      start->kernel = c->kernel;
+      start->sampleLength = c->sampleLength;
+    } else if (active) {
+      boolean wasSample = isSampleKernel(v->kernel);
+      setVoiceWaveform(i, c);
+      if ((v->released) && (wasSample) && (!isSampleKernel(v->kernel))) {
+	// a sample is released by shortening it, so its envelope has no
+	// release to carry on with, and it ends instead
+	v->pendingOff = true;
+      }
+    }
+    break;
+  }
+}
+
+// Start the deferred voices whose start time falls in the block that
+// begins at sample time t. A voice that is still sounding is being stolen:
+// it is faded out to avoid a click, timed to end before the new note is
+// due. Starts that are already late are applied right away.
+void startDueVoices(uint32_t t) {
+  for(byte i=0;i<MAX_NOTES;i++) {
+    voice_t *v = &voice[i];
+    if (!v->startDeferred) {
+      continue;
+    }
+    int32_t offset = v->deferredStart.startTime - t;
+    if (activeVoiceMask & (1 << i)) {
+      if ((!v->fading) && (offset < AUDIO_BLOCK_SIZE + STEAL_FADE_SAMPLES)) {
+	v->fading = true;
+	v->fadeGain = v->gain;
+	v->fadeStep = v->fadeGain / STEAL_FADE_SAMPLES;
+	if (v->fadeStep == 0) {
+	  v->fadeStep = 1;
 	}
+	v->pendingOff = true;
       }
-      mix = mix >> 1;
-      mix = adjustAmplitude(mix, n->volume);
-      sum += mix;
+      continue;
+    }
+    if (offset >= AUDIO_BLOCK_SIZE) {
+      continue;
+    }
+    if (offset < 0) {
+      offset = 0;
+    }
+    startVoice(i, &v->deferredStart, offset);
+  }
+}
+
+// Apply the commands of both queues in the order they were queued, so a
+// stop from the main loop can't land after a start the sequencer queued
+// later for the same voice. There are never more than 2 *
+// VOICE_QUEUE_SIZE commands waiting, so the 8 bit numbers compare.
+void drainVoiceQueues() {
+  voiceQueue_t *q0 = &voiceQueue[0];
+  voiceQueue_t *q1 = &voiceQueue[1];
+  byte tail0 = q0->tail;
+  byte tail1 = q1->tail;
+  byte head0 = q0->head;
+  byte head1 = q1->head;
+  asm volatile("" ::: "memory");
+  while ((tail0 != head0) || (tail1 != head1)) {
+    voiceQueue_t *q;
+    byte *tail;
+    if ((tail1 == head1) ||
+	((tail0 != head0) && ((int8_t)(q0->cmd[tail0].seq - q1->cmd[tail1].seq) < 0))) {
+      q = q0;
+      tail = &tail0;
+    } else {
+      q = q1;
+      tail = &tail1;
+    }
+    applyVoiceCommand(&q->cmd[*tail]);
+    *tail = (*tail + 1) & (VOICE_QUEUE_SIZE - 1);
+  }
+  q0->tail = tail0;
+  q1->tail = tail1;
+}
+
+#ifdef DEBUG_ENABLE
+// Number of cycles elapsed since the block before audioBuf[b] started
+// playing. The channel playing the other buffer tells us how far into
+// its block it is.
+unsigned long blockCycles(byte b) {
+  DMA_CH_t *playing = (b == 0) ? &DMA.CH1 : &DMA.CH0;
+  return (unsigned long)(AUDIO_BLOCK_SIZE - (playing->TRFCNT / AUDIO_FRAME_BYTES)) * TCC0.PER + TCC0.CNT;
+}
+#endif
+
+#ifdef STEREO_OUTPUT
+// Add count samples of a voice, rendered into voiceMix[], to the left
+// and right buses at pan position pan.
+static void panVoice(const mix_t *voiceMix, mix_t *left, mix_t *right, byte count, byte pan) {
+  byte gainLeft = pgm_read_byte(&panGain[pan]);
+  byte gainRight = pgm_read_byte(&panGain[PAN_RIGHT - pan]);
+  for(byte s=0;s<count;s++) {
+    mix_t x = voiceMix[s];
+    left[s] += scaleMix(x, gainLeft);
+    right[s] += scaleMix(x, gainRight);
+  }
+}
+#endif
 
-      n->volLevelRemaining--;
+// Level of the mix for each number of active voices, MAX_NOTE_VOL for
+// full level, see setHeadroom().
+byte headroomGain[MAX_NOTES + 1];
+
+// The headroom gain the output stage is at, 8.8 fixed point. It ramps to
+// the gain for the voice count over each block, like the voice gains.
+unsigned int mixGain = MAX_NOTE_VOL << 8;
+
+// Size the mix for setting voices. Up to that many voices play at full
+// level; beyond it the mix is turned down by the square root of the
+// number of voices, which keeps the loudness of a chord about the same,
+// and softClip() rounds off the peaks that still go over. 0 leaves the
+// mix at full level. The output ISR picks the new gains up in its next
+// block.
+void setHeadroom(byte setting) {
+  if (setting > MAX_NOTES) {
+    setting = HEADROOM_DEFAULT;
+  }
+  headroomSetting = setting;
+  for(byte n=0;n<=MAX_NOTES;n++) {
+    byte gain = MAX_NOTE_VOL;
+    if ((setting != 0) && (n > setting)) {
+      gain = MAX_NOTE_VOL * sqrt((float)setting / n);
+    }
+    headroomGain[n] = gain;
+  }
+}
+
+// Scale a mix bus value by the headroom gain down to the 16 bit output
+// bus, which has MIX_BUS_FRACTION_BITS below the DAC LSB and room for
+// twice the DAC range before it saturates. A voice at full volume comes
+// to a quarter of the DAC range, as it did with the old 16 bit mix.
+static inline int busSample(mix_t v, byte gain) {
+  mix_t x = scaleMix(v, gain) >> 6;
+  if (x > 32767) {
+    x = 32767;
+  } else if (x < -32767) {
+    x = -32767;
+  }
+  return x;
+}
+
+#define SVF_STATE_LIMIT 16383
+
+// x * c, with c a Q15 coefficient. c can be up to 2.0 (svfF at the
+// stability limit), so it is taken as unsigned.
+static inline int svfProduct(int x, unsigned int c) {
+  return ((long)(x << 1) * c) >> 16;
+}
+
+static inline int svfClamp(long x) {
+  if (x > SVF_STATE_LIMIT) {
+    return SVF_STATE_LIMIT;
+  } else if (x < -SVF_STATE_LIMIT) {
+    return -SVF_STATE_LIMIT;
+  }
+  return x;
+}
+
+// One pass of the Chamberlin state variable filter. It runs at half the
+// scale of the output bus so the resonant peak has room in an int, and
+// the low and band pass state is held to SVF_STATE_LIMIT so a
+// coefficient change can't run it away. setFilterFeedback() keeps svfF
+// under the limit where one pass per sample is stable.
+static inline int svfSample(int in, filterState_t *st) {
+  int x = in >> 1;
+  int low = svfClamp((long)st->low + svfProduct(st->band, svfF));
+  int high = svfClamp((long)x - low - svfProduct(st->band, svfQ));
+  int band = svfClamp((long)st->band + svfProduct(high, svfF));
+  st->low = low;
+  st->band = band;
+  int y;
+  switch (filterMode) {
+  case FILTER_MODE_HIGHPASS:
+    y = high;
+    break;
+  case FILTER_MODE_BANDPASS:
+    y = band;
+    break;
+  case FILTER_MODE_NOTCH:
+    y = svfClamp((long)low + high);
+    break;
+  default:
+    y = low;
+    break;
+  }
+  return y << 1;
+}
+
+// The output filter on one channel, whose state is kept in *st. The
+// legacy resonant low pass filter keeps its state in longs because the
+// resonance can take the full output bus past the range of an int. A
+// low pass filter with the cutoff all the way up is left out.
+//
+// Cycles per sample, measured as outputCycles with no voices playing:
+// about 140 for the legacy filter and 110 for the state variable filter,
+// which trades two of the long multiplies for three 16x16 ones.
+static inline int filterSample(int sum, filterState_t *st) {
+  if (filterMode == FILTER_MODE_LEGACY) {
+    if (filterCutoff != 255) {
+      long tmp = (sum - st->buf0) + ((feedback * (st->buf0 - st->buf1)) >> 8);
+      st->buf0 += ((long)filterCutoff * tmp) >> 8;
+      st->buf1 += ((long)filterCutoff * (st->buf0 - st->buf1)) >> 8;
+      long y = st->buf1;
+      if (y > 32767) {
+	y = 32767;
+      } else if (y < -32767) {
+	y = -32767;
+      }
+      sum = y;
     }
+  } else if ((filterMode != FILTER_MODE_LOWPASS) || (filterCutoff != 255)) {
+    sum = svfSample(sum, st);
   }
+  return sum;
+}
+
+#define SOFT_CLIP_KNEE 8192 // half the DAC range on the output bus
+#define SOFT_CLIP_STEP_BITS 7
+
+// Soft clipping curve above SOFT_CLIP_KNEE, one entry every 128 steps of
+// the output bus: knee + knee * tanh((x - knee) / knee), which meets the
+// straight line below the knee without a bend and levels off just under
+// the full DAC range at twice the range.
+const int16_t softClipCurve[193] PROGMEM = {8192, 8320, 8448, 8576, 8703, 8831, 8958, 9084, 9211, 9336, 9462, 9586, 9710, 9833, 9956, 10078, 10198, 10318, 10437, 10555, 10672, 10788, 10902, 11015, 11128, 11239, 11348, 11457, 11564, 11669, 11773, 11876, 11978, 12078, 12176, 12273, 12369, 12463, 12555, 12646, 12735, 12823, 12909, 12994, 13077, 13159, 13239, 13318, 13395, 13471, 13545, 13617, 13689, 13758, 13826, 13893, 13958, 14022, 14085, 14146, 14206, 14264, 14321, 14377, 14431, 14484, 14536, 14587, 14636, 14684, 14731, 14777, 14822, 14865, 14908, 14949, 14990, 15029, 15067, 15105, 15141, 15177, 15211, 15245, 15277, 15309, 15340, 15370, 15400, 15428, 15456, 15483, 15509, 15535, 15559, 15584, 15607, 15630, 15652, 15673, 15694, 15715, 15735, 15754, 15772, 15791, 15808, 15825, 15842, 15858, 15874, 15889, 15904, 15918, 15932, 15946, 15959, 15971, 15984, 15996, 16008, 16019, 16030, 16041, 16051, 16061, 16071, 16080, 16089, 16098, 16107, 16115, 16123, 16131, 16139, 16146, 16154, 16161, 16167, 16174, 16180, 16187, 16193, 16198, 16204, 16209, 16215, 16220, 16225, 16230, 16234, 16239, 16243, 16248, 16252, 16256, 16260, 16264, 16267, 16271, 16274, 16278, 16281, 16284, 16287, 16290, 16293, 16296, 16298, 16301, 16304, 16306, 16308, 16311, 16313, 16315, 16317, 16319, 16321, 16323, 16325, 16327, 16329, 16330, 16332, 16334, 16335, 16337, 16338, 16340, 16341, 16342, 16343};
 
-  // Filter:
-  if (filterCutoff != 255) {
-    int tmp = (sum - buf0) + (feedback * (buf0 - buf1) >> 8);
-    buf0 += ((long)filterCutoff * tmp) >> 8;
-    buf1 += ((long)filterCutoff * (buf0 - buf1)) >> 8;
-    sum = buf1;
+// Pass the output bus through below the knee and follow softClipCurve[]
+// above it, interpolating between entries.
+static inline int softClip(int x) {
+  boolean negative = (x < 0);
+  unsigned int a = (negative) ? -x : x;
+  if (a > SOFT_CLIP_KNEE) {
+    unsigned int i = a - SOFT_CLIP_KNEE;
+    byte index = i >> SOFT_CLIP_STEP_BITS;
+    int y0 = pgm_read_word(&softClipCurve[index]);
+    int y1 = pgm_read_word(&softClipCurve[index + 1]);
+    a = y0 + scaleVolume(y1 - y0, (i << (8 - SOFT_CLIP_STEP_BITS)) & 0xFF);
   }
-  
-  output = sum + SILENCE;
+  return (negative) ? -(int)a : a;
+}
+
+#ifdef DITHER_OUTPUT
+uint16_t ditherState = 1;
 
-  // clip
-  if (output < 0) {
-    output = 0;
+// Triangular (TPDF) dither for the bits of the output bus below the DAC
+// LSB: the difference of two uniform values of 0..7 eighths of an LSB,
+// both taken from one step of a 16 bit xorshift generator.
+static inline int ditherNoise() {
+  uint16_t x = ditherState;
+  x ^= x << 7;
+  x ^= x >> 9;
+  x ^= x << 8;
+  ditherState = x;
+  return (int)(x & 7) - (int)((x >> 8) & 7);
+}
+#endif
+
+// Round an output bus sample to the 12 bit DAC, with dither if it is
+// built in, and move it to the middle of the DAC range.
+static inline uint16_t dacSample(int sum) {
+#ifdef DITHER_OUTPUT
+  sum += ditherNoise();
+#endif
+  sum = (sum + (1 << (MIX_BUS_FRACTION_BITS - 1))) >> MIX_BUS_FRACTION_BITS;
+  sum += SILENCE;
+  if (sum < 0) {
+    sum = 0;
   } 
   else {
-    if (output > 4095) {
-      output = 4095;
+    if (sum > 4095) {
+      sum = 4095;
     }
   }
+  return sum;
+}
 
+// Render AUDIO_BLOCK_SIZE samples into audioBuf[b].
+// The queued voice commands are applied first and the voices due in this
+// block are started, then each voice is rendered for the whole block
+// before moving to the next one so its state only has to be loaded once
+// per block. A voice that starts in this block is rendered from its start
+// offset, which keeps note timing exact to the sample.
+void renderBlock(byte b) {
+  mix_t mix[AUDIO_BLOCK_SIZE];
+#ifdef STEREO_OUTPUT
+  // mix[] is the center bus. A voice panned elsewhere is rendered into
+  // voiceMix[] and added to the left and right buses by panVoice().
+  mix_t mixLeft[AUDIO_BLOCK_SIZE];
+  mix_t mixRight[AUDIO_BLOCK_SIZE];
+  mix_t voiceMix[AUDIO_BLOCK_SIZE];
+#endif
+  byte s;
+
+  // The other channel is playing now. getSampleTime() must not see the
+  // flag cleared without the channel changed.
+  byte oldSREG = SREG;
+  cli();
+  ((b == 0) ? &DMA.CH0 : &DMA.CH1)->CTRLB |= DMA_CH_TRNIF_bm;
+  playingChannel = b ^ 1;
+  playingBlockTime = sampleCount - AUDIO_BLOCK_SIZE;
+  SREG = oldSREG;
+
+  drainVoiceQueues();
+  startDueVoices(sampleCount);
+  advanceLFOs();
+  advanceModulation();
+
+  for(s=0;s<AUDIO_BLOCK_SIZE;s++) {
+    mix[s] = 0;
+#ifdef STEREO_OUTPUT
+    mixLeft[s] = 0;
+    mixRight[s] = 0;
+#endif
+  }
 
+  byte j = 0;
+  while (j < nActiveVoices) {
+    byte i = activeVoices[j];
+    voice_t *v = &voice[i];
 #ifdef DEBUG_ENABLE
-  counterEnd = TCC0.CNT;
+    unsigned long start = blockCycles(b);
 #endif
-}
+    byte offset = v->startOffset;
+    byte n = AUDIO_BLOCK_SIZE - offset;
+    byte count;
+    boolean ending = false;
+    mix_t *out = mix + offset;
+    v->startOffset = 0;
+    voicePitchMod = (lfoPitchModOn) ? lfoPitchMod + offset : NULL;
+#ifdef STEREO_OUTPUT
+    // The pan routes of advanceEnvelope() can move the voice on or off
+    // the center, so the bus is chosen once from the pan it had before,
+    // and the new pan is heard from the next block.
+    byte pan = v->pan;
+    if (pan != PAN_CENTER) {
+      out = voiceMix;
+      for(s=0;s<n;s++) {
+	voiceMix[s] = 0;
+      }
+    }
+#endif
+    if (v->fading) {
+      count = fadeVoice(v, out, n);
+    } else {
+      advanceEnvelope(v, sampleCount);
+      // a stopped voice renders this one block as it ramps to zero
+      ending = v->pendingOff;
+      rampGain(v, n);
+      if (v->filterCutoff != VOICE_FILTER_OFF) {
+	count = filteredRenderKernels[v->kernel](v, out, n);
+      } else {
+	count = renderKernels[v->kernel](v, out, n);
+      }
+    }
+#ifdef STEREO_OUTPUT
+    if (pan != PAN_CENTER) {
+      panVoice(voiceMix, mixLeft + offset, mixRight + offset, count, pan);
+    }
+#endif
+#ifdef DEBUG_ENABLE
+    if (count == AUDIO_BLOCK_SIZE) {
+      unsigned int cycles = (blockCycles(b) - start) / AUDIO_BLOCK_SIZE;
+      volatile unsigned int *measured = (v->filterCutoff != VOICE_FILTER_OFF) ? filteredKernelCycles : kernelCycles;
+      if (cycles > measured[v->kernel]) {
+	measured[v->kernel] = cycles;
+      }
+    }
+#endif
+    if ((count < n) || (ending)) {
+      // the voice ended, drop it from the active list. A new note
+      // waiting for the voice is started by startDueVoices().
+      activeVoices[j] = activeVoices[--nActiveVoices];
+      activeVoiceMask &= ~(1 << i);
+    } else {
+      j++;
+    }
+  }
 
+#ifdef DEBUG_ENABLE
+  unsigned long outputStart = blockCycles(b);
+#endif
+  // the headroom gain follows the number of voices still playing
+  long gainDelta = ((long)headroomGain[nActiveVoices] << 8) - mixGain;
+  int mixGainStep = gainDelta / AUDIO_BLOCK_SIZE;
+  uint16_t *buf = audioBuf[b];
+#ifdef STEREO_OUTPUT
+  byte centerGain = pgm_read_byte(&panGain[PAN_CENTER]);
+  for(s=0;s<AUDIO_BLOCK_SIZE;s++) {
+    mixGain += mixGainStep;
+    byte gain = mixGain >> 8;
+    mix_t center = scaleMix(mix[s], centerGain);
+    *buf++ = dacSample(softClip(filterSample(busSample(center + mixLeft[s], gain), &filterState[0])));
+    *buf++ = dacSample(softClip(filterSample(busSample(center + mixRight[s], gain), &filterState[1])));
+  }
+#else
+  for(s=0;s<AUDIO_BLOCK_SIZE;s++) {
+    mixGain += mixGainStep;
+    *buf++ = dacSample(softClip(filterSample(busSample(mix[s], mixGain >> 8), &filterState[0])));
+  }
+#endif
+  sampleCount += AUDIO_BLOCK_SIZE;
 
-/*
- * Adjust amplitude using only bitshifting.  Crude but cheap.
- */
-int adjustAmplitude(int v, byte level) {
-  int tmp, tmp2;
-  switch(level) {
-  case 0: 
-    return 0;
-  case 1: // v - 63/64
-    return (v >> 6);
-  case 2: // v - 62/64
-    return (v >> 5);
-  case 3: // v - 61/64
-    tmp = (v >> 4);
-    return tmp - (tmp >> 2);
-  case 4: // v - 60/64
-    return (v >> 4);
-  case 5: // v - 59/64
-    tmp = (v >> 4);
-    return tmp + (tmp >> 2);
-  case 6: // v - 58/64
-    tmp = (v >> 3);
-    return tmp - (tmp >> 2);
-  case 7: // v - 57/64
-    tmp = (v >> 3);
-    return tmp - (tmp >> 3);
-  case 8: // v - 56/64
-    return (v >> 3);
-  case 9: // v - 55/64
-    tmp = (v >> 3);
-    return tmp + (tmp >> 3);
-  case 10: // v - 54/64
-    tmp = (v >> 3);
-    return tmp + (tmp >> 2);
-  case 11: // v - 53/64 
-    tmp = (v >> 3);
-    tmp2 = (tmp >> 2);
-    return tmp + tmp2 + (tmp2 >> 1);
-  case 12: // v - 52/64 
-    tmp = (v >> 2);
-    return tmp - (tmp >> 2);
-  case 13: // v - 51/64
-    tmp = (v >> 2);
-    tmp2 = (tmp >> 3);
-    return (tmp - tmp2) - (tmp2 >> 1);
-  case 14: // v - 50/64 
-    tmp = (v >> 2);
-    return tmp - (tmp >> 3);
-  case 15: // v - 49/64 
-    tmp = (v >> 2);
-    return tmp - (tmp >> 4);
-  case 16: // v - 48/64 
-    return (v >> 2);
-  case 17: // v - 47/64 
-    tmp = (v >> 2);
-    return tmp + (tmp >> 4);
-  case 18: // v - 46/64 
-    tmp = (v >> 2);
-    return tmp + (tmp >> 3);
-  case 19: // v - 45/64
-    tmp = (v >> 2);
-    tmp2 = (tmp >> 2);
-    return (tmp + tmp2) - (tmp2 >> 2);
-  case 20: // v - 44/64
-    tmp = (v >> 2);
-    return tmp + (tmp >> 2);
-  case 21: // v - 43/64
-    tmp = (v >> 2);
-    tmp2 = (tmp >> 2);
-    return tmp + tmp2 + (tmp2 >> 2);
-  case 22: // v - 42/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 2);
-    return (tmp - tmp2) - (tmp2 >> 2);
-  case 23: // v = 41/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 2);
-    return (tmp - tmp2) - (tmp2 >> 3);
-  case 24: // v = 40/64
-    tmp = (v >> 1);
-    return tmp - (tmp >> 2);
-  case 25: // v = 39/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 2);
-    return (tmp - tmp2) + (tmp2 >> 3);
-  case 26: // v - 38/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 3);
-    return (tmp - tmp2) - (tmp2 >> 1);
-  case 27: // v - 37/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 3);
-    return (tmp - tmp2) - (tmp2 >> 2);
-  case 28: // v - 36/64
-    tmp = (v >> 1);
-    return tmp - (tmp >> 3);
-  case 29: // v - 35/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 4);
-    return (tmp - tmp2) - (tmp2 >> 1);
-  case 30: // v - 34/64
-    tmp = (v >> 1);
-    return tmp - (tmp >> 4);
-  case 31: // v - 33/64
-    tmp = (v >> 1);
-    return tmp - (tmp >> 5);
-  case 32: // v - 32/64
-    return v >> 1;
-  case 33: // v - 31/64
-    tmp = (v >> 1);
-    return tmp + (tmp >> 5);
-  case 34: // v - 30/64
-    tmp = (v >> 1);
-    return tmp + (tmp >> 4);
-  case 35: // v - 29/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 4);
-    return tmp + tmp2 + (tmp2 >> 1);
-  case 36: // v - 28/64
-    tmp = (v >> 1);
-    return tmp + (tmp >> 3);
-  case 37: // v - 27/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 3);
-    return tmp + tmp2 + (tmp2 >> 2);
-  case 38: // v - 26/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 3);
-    return tmp + tmp2 + (tmp2 >> 1);
-  case 39: // v - 25/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 3);
-    return tmp + tmp2 + (tmp2 >> 1) + (tmp2 >> 2);
-  case 40: // v - 24/64
-    tmp = (v >> 1);
-    return tmp + (tmp >> 2);
-  case 41: // v - 23/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 2);
-    return tmp + tmp2 + (tmp2 >> 3);
-  case 42: // v - 22/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 2);
-    return tmp + tmp2 + (tmp2 >> 2);
-  case 43: // v - 21/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 2);
-    return tmp + tmp2 + (tmp2 >> 2) + (tmp2 >> 3);
-  case 44: // v - 20/64
-    tmp = (v >> 1);
-    tmp2 = (tmp >> 2);
-    return tmp + tmp2 + (tmp2 >> 1);
-  case 45: // v - 19/64
-    tmp = (v >> 2);
-    tmp2 = (tmp >> 3);
-    return (v - tmp) - tmp2 - (tmp2 >> 1);
-  case 46: // v - 18/64
-    tmp = (v >> 2);
-    return (v - tmp) - (tmp >> 3);
-  case 47: // v - 17/64
-    tmp = (v >> 2);
-    return (v - tmp) - (tmp >> 4);
-  case 48: // v - 16/64
-    return v - (v >> 2);
-  case 49: // v - 15/64
-    tmp = (v >> 2);
-    return (v - tmp) + (tmp >> 4);
-  case 50: // v - 14/64
-    tmp = (v >> 2);
-    return (v - tmp) + (tmp >> 3);
-  case 51: // v - 13/64
-    tmp = (v >> 3);
-    return (v - tmp) - (tmp >> 1) - (tmp >> 3);
-  case 52: // v - 12/64
-    tmp = (v >> 3);
-    return (v - tmp) - (tmp >> 1);
-  case 53: // v - 11/64
-    tmp = (v >> 3);
-    tmp2 = (tmp >> 2);
-    return (v - tmp) - tmp2 - (tmp2 >> 1);
-  case 54: // v - 10/64
-    tmp = (v >> 3);
-    return (v - tmp) - (tmp >> 2);
-  case 55: // v - 9/64
-    tmp = (v >> 3);
-    return (v - tmp) - (tmp >> 3);
-  case 56: // v - 8/64 = 1/8
-    return v - (v >> 3);
-  case 57: // v - 7/64
-    tmp = (v >> 4);
-    return (v - tmp) - (tmp >> 2) - (tmp >> 1);
-  case 58: // v - 6/64
-    tmp = (v >> 4);
-    return (v - tmp) - (tmp >> 1);
-  case 59: // v - 5/64
-    tmp = (v >> 4);
-    return (v - tmp) - (tmp >> 2);
-  case 60: // v - 4/64 = 1/16
-    return v - (v >> 4); 
-  case 61: // v - 3/64
-    tmp = (v >> 5);
-    return (v - tmp) - (tmp >> 1);
-  case 62: // v - 2/64 = 1/32
-    return v - (v >> 5);
-  case 63: // v - 1/64
-    return v - (v >> 6); 
-  case 64:
-    return v;
-  }
-  return 0;
+#ifdef DEBUG_ENABLE
+  unsigned int cycles = (blockCycles(b) - outputStart) / AUDIO_BLOCK_SIZE;
+  if (cycles > outputCycles) {
+    outputCycles = cycles;
+  }
+  // Report the average number of cycles used per sample, so the debug
+  // output can still compare it against the TCC0 period.
+  counterEnd = blockCycles(b) / AUDIO_BLOCK_SIZE;
+#endif
 }
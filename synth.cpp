@@ -58,7 +58,7 @@ void readSynthButtons() {
 	    // button released
 	    note[noteIndex].trigger = UNSET;
 	    button[i].noteIndex = UNSET;
-	    doNoteOff(selectedSettings+1, button[i].midiVal);
+	    doNoteOff(selectedSettings+1, button[i].midiVal, getSampleCount());
 	  }
 	}
       }
@@ -68,311 +68,555 @@ void readSynthButtons() {
 
 void initNote(byte i, byte midiNote) {
   note[i].midiChannel = 0;
-  note[i].volume = 0;
-  note[i].volumeNext = 0;
-  note[i].volumeScale = 1.0;
-  note[i].volumeScaled = false;
-  note[i].doScale = false;
-  note[i].lastFrequency = 0.0;
-  note[i].phase = 0;
+  note[i].peakIndex = 0;
+  note[i].sustainIndex = MAX_NOTE_VOL; // no decay
+  note[i].attackInc = 0;
+  note[i].decayInc = 0;
+  note[i].volumeScale = MAX_NOTE_VOL;
+  note[i].pan = PAN_CENTER;
+  note[i].filterCutoff = VOICE_FILTER_OFF;
+  note[i].filterEnvelope = 0;
+  note[i].lastPitch = 0;
   note[i].phaseInc = 0;
-  note[i].phaseFraction = 0;
-  note[i].phaseFractionInc = 0;
+  note[i].started = false;
+  note[i].releasePending = false;
+  note[i].waveformPending = false;
+  note[i].startTime = getSampleCount();
+#ifdef DEBUG_ENABLE
+  note[i].requestTime = note[i].startTime;
+#endif
   note[i].midiVal = midiNote;
   note[i].isSample = false;
   note[i].isPreview = false;
   note[i].waveform = UNSET;
   note[i].trigger = UNSET;
+  note[i].velocity = MAX_VELOCITY;
+  selectKernel(i);
+  moveVoice(i, VOICE_LIST_ACTIVE);
 }
 
-// find a note in the array of MAX_NOTES available notes to use
-byte findNoteIndex() {
+// Start note i at sample time t instead of as soon as the output ISR
+// gets its start command. The envelope starts at the same time.
+void scheduleNote(byte i, uint32_t t) {
+  note[i].startTime = t;
+}
+
+// Start the voice of note i right away instead of on the next pass of
+// loop(), which refines the pitch later for detune, bend and LFO.
+// Used where notes are started from an interrupt.
+void startNoteNow(byte i) {
+  note[i].pitch = note[i].midiVal << PITCH_FRACTION_BITS;
+  setPhaseIncrement(i);
+  updateVoice(i);
+}
+
+// Voices are kept in three lists, each ordered from oldest to newest: free
+// voices, voices in their release phase and voices that are playing. A voice
+// moves to the tail of a list whenever it changes state, so the head of each
+// list is its oldest voice and allocation does not compare start times.
+byte voiceList[MAX_NOTES]; // the list each voice is in
+byte voiceNext[MAX_NOTES];
+byte voicePrev[MAX_NOTES];
+byte voiceListHead[N_VOICE_LISTS];
+byte voiceListTail[N_VOICE_LISTS];
+byte stealPolicy = STEAL_PROTECT_SAMPLES;
+// Number of voices notes are given, see setVoiceLimit()
+byte voiceLimit = MAX_NOTES;
+
+void initVoiceLists() {
+  for(byte l=0;l<N_VOICE_LISTS;l++) {
+    voiceListHead[l] = UNSET;
+    voiceListTail[l] = UNSET;
+  }
   for(byte i=0;i<MAX_NOTES;i++) {
-    // find a slot for this note
-    if (note[i].midiVal <= NOTE_PENDING_OFF) {
-      while ((note[i].midiVal != NOTE_OFF) && ((note[i].phaseInc > 0) || (note[i].phaseFractionInc > 0))) {
-	// wait until note reaches NOTE_OFF state to avoid click
-      }
-      return i;
+    voiceList[i] = UNSET;
+    moveVoice(i, VOICE_LIST_FREE);
+  }
+}
+
+// Move voice i to the tail of the given list. A voice above voiceLimit
+// that is freed or released is parked instead, out of reach of
+// findNoteIndex().
+void moveVoice(byte i, byte list) {
+  if ((list != VOICE_LIST_ACTIVE) && (i >= voiceLimit)) {
+    list = VOICE_LIST_PARKED;
+  }
+  // the sequencer interrupt allocates voices too
+  byte oldSREG = SREG;
+  cli();
+  byte from = voiceList[i];
+  if (from != UNSET) {
+    if (voicePrev[i] == UNSET) {
+      voiceListHead[from] = voiceNext[i];
+    } else {
+      voiceNext[voicePrev[i]] = voiceNext[i];
+    }
+    if (voiceNext[i] == UNSET) {
+      voiceListTail[from] = voicePrev[i];
+    } else {
+      voicePrev[voiceNext[i]] = voicePrev[i];
     }
   }
+  voiceNext[i] = UNSET;
+  voicePrev[i] = voiceListTail[list];
+  if (voiceListTail[list] == UNSET) {
+    voiceListHead[list] = i;
+  } else {
+    voiceNext[voiceListTail[list]] = i;
+  }
+  voiceListTail[list] = i;
+  voiceList[i] = list;
+  SREG = oldSREG;
+}
 
-  // There are no notes that are not being used. Check to see if any
-  // are in RELEASE envelope phase and use it. Find the oldest of the
-  // notes in RELEASE phase.
-  byte noteIndex = 255;
-  unsigned long oldest = millis();
+// Give new notes the first limit voices. The voices above it are
+// parked until the limit is raised again. A note that is playing on one
+// of them is not cut off: it plays on through its release as usual, but
+// its voice is not reused, so the load comes down as those notes end.
+// A voice that comes back under the limit returns to the list that
+// matches its note.
+void setVoiceLimit(byte limit) {
+  if (limit > MAX_NOTES) {
+    limit = MAX_NOTES;
+  }
+  voiceLimit = limit;
   for(byte i=0;i<MAX_NOTES;i++) {
-    if ((note[i].envelopePhase == RELEASE) && (!note[i].isSample) && (note[i].startTime < oldest)) {
-      noteIndex = i;
-      oldest = note[i].startTime;
+    if (i >= limit) {
+      if (voiceList[i] != VOICE_LIST_PARKED) {
+	moveVoice(i, VOICE_LIST_PARKED);
+      }
+    } else if (voiceList[i] == VOICE_LIST_PARKED) {
+      if (note[i].midiVal <= NOTE_PENDING_OFF) {
+	moveVoice(i, VOICE_LIST_FREE);
+      } else if (note[i].envelopePhase == RELEASE) {
+	moveVoice(i, VOICE_LIST_RELEASING);
+      } else {
+	moveVoice(i, VOICE_LIST_ACTIVE);
+      }
     }
   }
-  if (noteIndex != 255) {
-    stopNote(noteIndex);
-    return noteIndex;
-  }
+}
 
+// Worst case costs in cycles per sample, from the kernel costs in
+// output.cpp: the pink noise kernel drawing a value every sample, the
+// same through a voice filter, the pitch LFO in a kernel,
+// modulateVoice() for a voice with amplitude, pan, cutoff and pitch
+// routes, the panning of a voice off the center, and the output stage.
+// advanceLFOs() and the global modulation routes are paid once per
+// sample for all voices.
+#define VOICE_CYCLES 100
+#define FILTERED_VOICE_CYCLES 120
+#define VOICE_LFO_PITCH_CYCLES 20
+#define VOICE_MOD_CYCLES 10
+#define LFO_PITCH_CYCLES 90 // advanceLFOs() filling lfoPitchMod[]
+#define MOD_CYCLES 10       // advanceModulation() and setFilterFeedback()
+#ifdef STEREO_OUTPUT
+#define PAN_CYCLES 70
+#define OUTPUT_STAGE_CYCLES 320 // once per channel, and the center bus
+#else
+#define PAN_CYCLES 0
+#define OUTPUT_STAGE_CYCLES 150
+#endif
+
+// The number of voices the output ISR can render at the output rate when
+// every voice costs the worst case, leaving a quarter of the sample
+// period to the control code and the other interrupts. A filtered voice
+// costs more (see renderVoice()), so while any channel has voice filters
+// the polyphony comes down further, and so it does while the pitch LFO
+// or the modulation matrix is in use. At 25KHz a mono build plays 8
+// voices, 6 with voice filters or with the pitch LFO, at 16KHz 8, and
+// at 32KHz 6, or 5 with voice filters and 4 with the pitch LFO. loop()
+// calls this on every pass, so the limit follows the LFO and the routes.
+void updateVoiceLimit() {
+  unsigned int voiceCycles = VOICE_CYCLES + PAN_CYCLES;
+  for(byte c=0;c<N_SETTINGS;c++) {
+    if (settings[c].voiceFilterCutoff != VOICE_FILTER_OFF) {
+      voiceCycles = FILTERED_VOICE_CYCLES + PAN_CYCLES;
+    }
+  }
+  if ((nModRoutes[MOD_DST_AMPLITUDE] != 0) || (nModRoutes[MOD_DST_PITCH] != 0) ||
+      (nModRoutes[MOD_DST_PAN] != 0) || (nModRoutes[MOD_DST_VOICE_CUTOFF] != 0)) {
+    voiceCycles += VOICE_MOD_CYCLES;
+  }
+  unsigned int budget = ((F_CPU / outputRate) * 3) / 4 - OUTPUT_STAGE_CYCLES;
+  if (lfoEnabled[LFO_PITCH]) {
+    voiceCycles += VOICE_LFO_PITCH_CYCLES;
+    budget -= LFO_PITCH_CYCLES;
+  }
+  if ((lfoEnabled[LFO_FILTER]) || (nModRoutes[MOD_DST_CUTOFF] != 0) || (nModRoutes[MOD_DST_RESONANCE] != 0)) {
+    budget -= MOD_CYCLES;
+  }
+  unsigned int limit = budget / voiceCycles;
+  if (limit < 1) {
+    limit = 1;
+  } else if (limit > MAX_NOTES) {
+    limit = MAX_NOTES;
+  }
+  if (limit != voiceLimit) {
+    setVoiceLimit(limit);
+  }
+}
 
-  // All notes are being used. Choose the note that is "oldest".
-  // Start by looking for non-sample notes.
-  noteIndex = 255;
-  for(byte i=0;i<MAX_NOTES;i++) {
-    if (!note[i].isSample) {
-      noteIndex = i;
-      break;
+// Look for a voice that plays midiNote on channelNum, for retriggering.
+byte findSameNote(byte channelNum, byte midiNote) {
+  for(byte l=VOICE_LIST_RELEASING;l<=VOICE_LIST_ACTIVE;l++) {
+    for(byte i=voiceListHead[l];i!=UNSET;i=voiceNext[i]) {
+      if ((note[i].midiVal == midiNote) && ((note[i].midiChannel & 0x7F) == channelNum)) {
+	return i;
+      }
     }
   }
-  if (noteIndex != 255) {
-    for(byte i=0;i<MAX_NOTES;i++) {
-      if ((!note[i].isSample) && (note[i].startTime < note[noteIndex].startTime)) {
-	// try to find an older nonsample note.
+  return UNSET;
+}
+
+// Choose a playing voice to steal, according to stealPolicy.
+byte chooseStolenVoice() {
+  byte noteIndex = voiceListHead[VOICE_LIST_ACTIVE];
+  byte i;
+  switch (stealPolicy) {
+  case STEAL_QUIETEST:
+    for(i=noteIndex;i!=UNSET;i=voiceNext[i]) {
+      if (voiceVolume(i) < voiceVolume(noteIndex)) {
 	noteIndex = i;
       }
     }
-  } else {
-    // All notes are samples. Now try to find the oldest.
-    noteIndex = 0;
-    for(byte i=1;i<MAX_NOTES;i++) {
-      if (note[i].startTime < note[noteIndex].startTime) {
+    break;
+  case STEAL_LOWEST_VELOCITY:
+    for(i=noteIndex;i!=UNSET;i=voiceNext[i]) {
+      if (note[i].velocity < note[noteIndex].velocity) {
+	noteIndex = i;
+      }
+    }
+    break;
+  case STEAL_PROTECT_SAMPLES:
+    // the oldest note that is not a sample, or the oldest sample
+    for(i=noteIndex;i!=UNSET;i=voiceNext[i]) {
+      if (!note[i].isSample) {
 	noteIndex = i;
+	break;
       }
     }
+    break;
   }
-  // At this point noteIndex is the oldest note, giving priority to samples.
+  return noteIndex;
+}
 
-  if (note[noteIndex].phaseInc > 0) {
-    stopNote(noteIndex);
+// Find a voice for a new note on channelNum. Take a free voice if there
+// is one, else the oldest voice in its release phase, else steal a
+// playing voice. Only the quietest and lowest velocity policies walk a
+// list, and only when every voice is busy, so chords cost no more per
+// note than single notes.
+byte findNoteIndex(byte channelNum, byte midiNote) {
+  byte oldSREG = SREG;
+  cli();
+  byte i = UNSET;
+  if (stealPolicy == STEAL_SAME_NOTE) {
+    i = findSameNote(channelNum, midiNote);
   }
-  return noteIndex;
+  if (i == UNSET) {
+    i = voiceListHead[VOICE_LIST_FREE];
+  }
+  if (i == UNSET) {
+    i = voiceListHead[VOICE_LIST_RELEASING];
+    if (stealPolicy == STEAL_PROTECT_SAMPLES) {
+      while ((i != UNSET) && (note[i].isSample)) {
+	i = voiceNext[i];
+      }
+    }
+  }
+  if (i == UNSET) {
+    i = chooseStolenVoice();
+  }
+  if (i == UNSET) {
+    // only samples left, all of them releasing
+    i = voiceListHead[VOICE_LIST_RELEASING];
+  }
+  if (voiceList[i] != VOICE_LIST_FREE) {
+    // If the voice is still sounding, the output ISR fades it out
+    // before it starts the new note, so there is no need to wait here.
+    stopNote(i);
+  }
+  moveVoice(i, VOICE_LIST_ACTIVE);
+  SREG = oldSREG;
+  return i;
 }
 
 byte doNoteOn(byte channelNum, byte midiNote, byte velocity) {
-  byte i = findNoteIndex();
+#ifdef DEBUG_ENABLE
+  uint32_t requestTime = getSampleCount();
+#endif
+  byte i = findNoteIndex(channelNum, midiNote);
   if (velocity > MAX_VELOCITY) {
     velocity = MAX_VELOCITY;
   }
   initNote(i, midiNote);
-  note[i].startTime = millis();
+  note[i].velocity = velocity;
+#ifdef DEBUG_ENABLE
+  note[i].requestTime = requestTime;
+#endif
   note[i].midiChannel = channelNum;
-  byte waveformNum = settings[channelNum-1].waveform;
+  note[i].pan = settings[channelNum-1].pan;
+  byte waveformNum = modulatedWaveform(settings[channelNum-1].waveform,
+				       ((unsigned int)velocity * 127) / MAX_VELOCITY, midiNote);
   note[i].waveform = waveformNum;
   note[i].waveformBuf = waveformBuffers[waveformNum];
   if (waveformNum >= N_WAVEFORMS) {
     note[i].isSample = true;
     note[i].sampleLength = sampleLength[waveformNum - N_WAVEFORMS];
   }
+  selectKernel(i);
   note[i].envelopePhase = ATTACK;
-  note[i].volIndexInc = 1;
-  note[i].volLevelDuration = settings[channelNum-1].attackVolLevelDuration;
-  note[i].volLevelRemaining = settings[channelNum-1].attackVolLevelDuration;
 
-  note[i].targetVolIndex = map(velocity, 0, MAX_VELOCITY, 0, MAX_NOTE_VOL);
-
-  if ((settings[channelNum-1].attackVolLevelDuration > 0) && (!note[i].isSample)) {
-    note[i].volIndex = 0;
-    note[i].targetVolIndex = inverseAttackLogVolume[logVolume[note[i].targetVolIndex]];
-  } else {
-    // optimize if there is no attack.  go directly to target volume
-    note[i].volIndex = note[i].targetVolIndex;
-    note[i].volume = logVolume[note[i].volIndex];
-    note[i].volumeNext = note[i].volume;
+  // The output ISR runs the envelope. A sample has none, it plays at
+  // the peak volume (see sendVoiceCommand()).
+  settings_t *s = &settings[channelNum-1];
+  note[i].peakIndex = map(velocity, 0, MAX_VELOCITY, 0, MAX_NOTE_VOL);
+  // decay to the sustain volume which is a percentage of the original velocity
+  note[i].sustainIndex = (byte)(s->sustainVolLevel * note[i].peakIndex);
+  note[i].attackInc = envelopeInc(s->attackVolLevelDuration);
+  note[i].decayInc = envelopeInc(s->decayVolLevelDuration);
+
+  if (s->voiceFilterCutoff != VOICE_FILTER_OFF) {
+    // the cutoff follows the key from middle C, about 2.75 steps a
+    // semitone (see voiceFilterCoefficient[])
+    int cutoff = s->voiceFilterCutoff + (((midiNote - 60) * 11) >> 2);
+    note[i].filterCutoff = constrain(cutoff, 0, VOICE_FILTER_OFF - 1);
+    note[i].filterEnvelope = s->voiceFilterEnvelope;
   }
 
   // Restart filter LFO
-  lfoPhase[LFO_FILTER] = 0;
+  resetLFO(LFO_FILTER);
   return i;
 }
 
-// Release all notes on the specified channel with the specified MIDI note value.
-void doNoteOff(byte channelNum, byte midiNote) {
+// Release all notes on the specified channel with the specified MIDI note
+// value at sample time t.
+void doNoteOff(byte channelNum, byte midiNote, uint32_t t) {
   for(byte i=0;i<MAX_NOTES;i++) {
     // find the note
     byte midiChannel = note[i].midiChannel & 0x7F;
     if ((note[i].midiVal == midiNote) && (midiChannel == channelNum)) {
-      releaseNote(&note[i]);
+      scheduleRelease(&note[i], t);
     }
   }
 }
 
-void releaseNote(note_t *n) {
+// Release note n at sample time t. The output ISR starts the release in
+// the block it is due in, so a note started with scheduleNote() keeps the
+// length it was played with.
+void scheduleRelease(note_t *n, uint32_t t) {
+  byte channel = n->midiChannel & 0x7F; // mask off high bit channel 10 indicator
+  int releaseDur = settings[channel-1].releaseVolLevelDuration;
   if (n->isSample) {
-    byte channel = n->midiChannel & 0x7F; // mask off high bit channel 10 indicator
-    int releaseDur = settings[channel-1].releaseVolLevelDuration;
-    unsigned int l = n->phase + map(releaseDur, 0, RELEASE_RANGE/2, 0, (n->sampleLength - n->phase));
-    n->sampleLength = constrain(l, 0, n->sampleLength);
-    n->envelopePhase = RELEASE;
+    // The output ISR knows the sample position, so it shortens the
+    // rest of the sample to releaseValue/256.
+    n->releaseValue = map(constrain(releaseDur, 0, RELEASE_RANGE/2), 0, RELEASE_RANGE/2, 0, 256);
     n->trigger = UNSET;
-    return;
+  } else {
+    n->releaseValue = envelopeInc(releaseDur);
   }
+  n->releaseTime = t;
+  n->releasePending = true;
+  n->envelopePhase = RELEASE;
+  moveVoice(n - note, VOICE_LIST_RELEASING);
+  updateVoice(n - note);
+}
 
-  n->volIndexInc = -1;
-  n->targetVolIndex = 0;
-  n->volLevelDuration = settings[n->midiChannel-1].releaseVolLevelDuration;
-  n->volLevelRemaining = settings[n->midiChannel-1].releaseVolLevelDuration;
-  if (settings[n->midiChannel-1].releaseVolLevelDuration > 0) {
-    if (n->envelopePhase == ATTACK) {
-      // switch volumeIndex to logarithmic scale for RELEASE phase.
-      n->volIndex = inverseLogVolume[n->volume];
-      n->volume = logVolume[n->volIndex];
-      n->volumeNext = n->volume;
-    }
+void releaseNote(note_t *n) {
+  scheduleRelease(n, getSampleCount());
+}
+
+// The envelope step per block, in 8.8 fixed point, for an envelope
+// duration setting: each step of the volume contour lasts duration
+// 1/(1 << VOL_STEP_SHIFT) samples at SAMPLE_RATE. 0 jumps straight to
+// the end of the phase.
+unsigned int envelopeInc(int duration) {
+  if (duration <= 0) {
+    return 0;
   }
-  n->envelopePhase = RELEASE;
+  uint32_t inc = ((uint32_t)(AUDIO_BLOCK_SIZE << VOL_STEP_SHIFT) * envelopeRateScale) / duration;
+  if (inc > 0xFFFF) {
+    inc = 0xFFFF;
+  }
+  return inc;
 }
 
+// The note is free for reuse as soon as this returns. The output ISR
+// ramps the voice down to zero over one block to avoid a click.
 void stopNote(byte noteIndex) {
-  note[noteIndex].midiVal = NOTE_PENDING_OFF;
-  while ((note[noteIndex].midiVal != NOTE_OFF) && ((note[noteIndex].phaseInc > 0) || (note[noteIndex].phaseFractionInc > 0))) {
-    // wait until note reaches NOTE_OFF state to avoid click
+  note_t *n = &note[noteIndex];
+  n->midiVal = NOTE_OFF;
+  n->envelopePhase = OFF;
+  n->started = false;
+  n->releasePending = false;
+  n->waveformPending = false;
+  n->stopPending = true;
+  moveVoice(noteIndex, VOICE_LIST_FREE);
+  updateVoice(noteIndex);
+}
+
+// Send the output ISR whatever changed in note[i] since the last call.
+// A command that does not fit in the queue is retried on the next call,
+// so this never waits for the ISR. It is called for every note from the
+// main loop, and right away where a note is started or stopped outside
+// of it.
+void updateVoice(byte i) {
+  note_t *n = &note[i];
+  if (n->stopPending) {
+    if (!sendVoiceCommand(VOICE_CMD_STOP, i)) return;
+    n->stopPending = false;
+  }
+  if (n->midiVal <= NOTE_PENDING_OFF) return;
+
+  if (!n->started) {
+    // wait for setPhaseIncrement()
+    if (n->phaseInc == 0) return;
+    if (!sendVoiceCommand(VOICE_CMD_START, i)) return;
+    n->started = true;
+    n->sentPhaseInc = n->phaseInc;
+    n->sentVolumeScale = n->volumeScale;
+  }
+  if (n->releasePending) {
+    if (!sendVoiceCommand(VOICE_CMD_RELEASE, i)) return;
+    n->releasePending = false;
+  }
+  if (n->waveformPending) {
+    // the voice keeps its envelope, see setNoteWaveform()
+    if (n->phaseInc == 0) return;
+    if (!sendVoiceCommand(VOICE_CMD_SET_WAVEFORM, i)) return;
+    n->waveformPending = false;
+    n->sentPhaseInc = n->phaseInc;
+  }
+  if ((n->phaseInc != n->sentPhaseInc) && (sendVoiceCommand(VOICE_CMD_SET_INC, i))) {
+    n->sentPhaseInc = n->phaseInc;
+  }
+  if ((n->volumeScale != n->sentVolumeScale) && (sendVoiceCommand(VOICE_CMD_SET_GAIN, i))) {
+    n->sentVolumeScale = n->volumeScale;
   }
-  note[noteIndex].envelopePhase = OFF;
 }
 
-void setPhaseIncrement(byte i) {
-  if (note[i].waveformBuf == NULL) {
-    // For noise generation, we use the MIDI note value to set
-    // note phaseInc to a number representing the probability of 
-    // changing the noise output value on the next cycle.
-    // Instead of a linear mapping of midiVal, use the nonlinear frequency scale.
-    float lowFreq = noteTable[36-MIDI_LOW];
-    float highFreq = noteTable[72-MIDI_LOW];
-    float range = highFreq - lowFreq;
-    float f = note[i].frequency;
-    if (f < lowFreq) f = lowFreq;
-    if (f > highFreq) f = highFreq;
-    float diff = f - lowFreq;
-    float amt = (float)(diff / range);
-    int a = (int)(amt * 100.0);
-    note[i].phaseInc = map(a, 0, 100, 25, 2047);
-    return;
+// True if the output ISR started note i and the voice has since ended,
+// which is how a sample that played to its end is noticed.
+boolean voiceEnded(byte i) {
+  if (!note[i].started) return false;
+  if (voiceStartCount[i] != note[i].startCount) return false;
+  return !(activeVoiceMask & (1 << i));
+}
+
+// 2^(f/3072) - 1 in 0.16 fixed point, the fraction f of a semitone
+// (1/256 semitone steps) as a ratio to add to the phase increment.
+const uint16_t pitchFraction[1 << PITCH_FRACTION_BITS] PROGMEM = {
+  0, 15, 30, 44, 59, 74, 89, 104, 118, 133, 148, 163, 178, 193, 207, 222,
+  237, 252, 267, 282, 296, 311, 326, 341, 356, 371, 386, 400, 415, 430, 445, 460,
+  475, 490, 505, 520, 535, 549, 564, 579, 594, 609, 624, 639, 654, 669, 684, 699,
+  714, 729, 744, 758, 773, 788, 803, 818, 833, 848, 863, 878, 893, 908, 923, 938,
+  953, 968, 983, 998, 1013, 1028, 1043, 1058, 1073, 1088, 1103, 1118, 1134, 1149, 1164, 1179,
+  1194, 1209, 1224, 1239, 1254, 1269, 1284, 1299, 1314, 1329, 1344, 1360, 1375, 1390, 1405, 1420,
+  1435, 1450, 1465, 1480, 1496, 1511, 1526, 1541, 1556, 1571, 1586, 1601, 1617, 1632, 1647, 1662,
+  1677, 1692, 1708, 1723, 1738, 1753, 1768, 1784, 1799, 1814, 1829, 1844, 1859, 1875, 1890, 1905,
+  1920, 1936, 1951, 1966, 1981, 1996, 2012, 2027, 2042, 2057, 2073, 2088, 2103, 2119, 2134, 2149,
+  2164, 2180, 2195, 2210, 2225, 2241, 2256, 2271, 2287, 2302, 2317, 2333, 2348, 2363, 2379, 2394,
+  2409, 2425, 2440, 2455, 2471, 2486, 2501, 2517, 2532, 2547, 2563, 2578, 2593, 2609, 2624, 2640,
+  2655, 2670, 2686, 2701, 2716, 2732, 2747, 2763, 2778, 2794, 2809, 2824, 2840, 2855, 2871, 2886,
+  2902, 2917, 2932, 2948, 2963, 2979, 2994, 3010, 3025, 3041, 3056, 3072, 3087, 3103, 3118, 3134,
+  3149, 3165, 3180, 3196, 3211, 3227, 3242, 3258, 3273, 3289, 3304, 3320, 3335, 3351, 3366, 3382,
+  3397, 3413, 3429, 3444, 3460, 3475, 3491, 3506, 3522, 3538, 3553, 3569, 3584, 3600, 3616, 3631,
+  3647, 3662, 3678, 3694, 3709, 3725, 3740, 3756, 3772, 3787, 3803, 3819, 3834, 3850, 3866, 3881
+};
+
+// The 16.16 phase increment for pitch, from the table of increments
+// of the notes from PITCH_TOP_OCTAVE up (see setOutputRate()). Lower
+// octaves halve the increment, and the fraction of a semitone scales
+// it by pitchFraction[]. This and pitchRatio() are the only exponentials
+// in the pitch path.
+uint32_t pitchIncrement(const uint32_t *semitoneInc, int pitch) {
+  if (pitch < 0) {
+    pitch = 0;
+  }
+  byte semitone = pitch >> PITCH_FRACTION_BITS;
+  byte octaves = 0;
+  while (semitone < PITCH_TOP_OCTAVE) {
+    semitone += 12;
+    octaves++;
   }
+  uint32_t inc = semitoneInc[semitone - PITCH_TOP_OCTAVE];
+  uint16_t fraction = pgm_read_word(&pitchFraction[pitch & ((1 << PITCH_FRACTION_BITS) - 1)]);
+  // inc * fraction >> 16 without overflowing 32 bits
+  inc += ((inc >> 16) * fraction) + (((inc & 0xFFFF) * fraction) >> 16);
+  return inc >> octaves;
+}
 
-  // don't recompute phase if the frequency has not changed.
-  if (note[i].frequency == note[i].lastFrequency) return;
+// 2^(s/12) in 2.14 fixed point, for s semitones up to an octave
+const uint16_t semitoneRatio[12] PROGMEM = {
+  16384, 17358, 18390, 19484, 20643, 21870, 23170, 24548, 26008, 27554, 29193, 30929
+};
+
+// The ratio of the phase increments of two pitches pitch apart, in 2.14
+// fixed point, for less than an octave up or down.
+unsigned int pitchRatio(int pitch) {
+  pitch = constrain(pitch, -(12 << PITCH_FRACTION_BITS) + 1, (12 << PITCH_FRACTION_BITS) - 1);
+  // an octave up from pitch, and halved below
+  unsigned int up = pitch + (12 << PITCH_FRACTION_BITS);
+  byte semitone = up >> PITCH_FRACTION_BITS;
+  byte octaves = 1;
+  if (semitone >= 12) {
+    semitone -= 12;
+    octaves = 0;
+  }
+  uint32_t ratio = pgm_read_word(&semitoneRatio[semitone]);
+  ratio += (ratio * pgm_read_word(&pitchFraction[up & ((1 << PITCH_FRACTION_BITS) - 1)])) >> 16;
+  return ratio >> octaves;
+}
 
-  if ((note[i].volumeScale != 1.0) && (!note[i].volumeScaled)) {
-    // don't let the note be played until we have adjusted the
-    // volume in processEnvelope. This avoids clicks.
+void setPhaseIncrement(byte i) {
+  // don't recompute phase if the pitch has not changed.
+  if (note[i].pitch == note[i].lastPitch) return;
+
+  if (note[i].waveformBuf == NULL) {
+    // Noise is a sample and hold that draws a new value each time its
+    // 16 bit phase carries, at 25KHz for MIDI note 72 and an octave
+    // lower for every 12 notes below, up to one value per sample.
+    uint32_t inc = pitchIncrement(sampleSemitoneInc, note[i].pitch) >> 1;
+    note[i].phaseInc = (inc > NOISE_MAX_INC) ? NOISE_MAX_INC : inc;
+    note[i].tableBuf = NULL;
+    note[i].lastPitch = note[i].pitch;
     return;
   }
 
-  note[i].lastFrequency = note[i].frequency;
-  float phaseIncFloat;
+  note[i].lastPitch = note[i].pitch;
   if (!note[i].isSample) {
-    phaseIncFloat = (note[i].frequency * N_WAVEFORM_SAMPLES) / OUTPUT_RATE;
+    note[i].phaseInc = pitchIncrement(waveSemitoneInc, note[i].pitch + tuningPitch);
+    // the pitch LFO and pitch routes are applied by the output ISR,
+    // which can't change the mipmap, so take the one for the top of
+    // their swing
+    uint32_t peakInc = pitchIncrement(waveSemitoneInc, note[i].pitch + tuningPitch + lfoPitchPeak() + modPitchPeak);
+    note[i].tableBuf = mipmapTable(note[i].waveformBuf, peakInc);
   } else {
-    // for samples, we want the phase increment to be 1 for midiVal = 60 (middle C)
-    phaseIncFloat = note[i].frequency / noteTable[60-MIDI_LOW];
-  }
-  // convert the phase increment to an int
-  note[i].phaseInc = (int)phaseIncFloat;
-  // but also use a counter to keep track of the fractional part
-  phaseIncFloat -= note[i].phaseInc;
-  note[i].phaseFractionInc = (byte)(phaseIncFloat * 256.0);
+    // middle C plays a sample at the rate it was recorded at
+    note[i].phaseInc = pitchIncrement(sampleSemitoneInc, note[i].pitch);
+    note[i].tableBuf = note[i].waveformBuf;
+  }
 }
 
-void processEnvelope(byte i) {
-  if ((note[i].isSample) || (note[i].envelopePhase == SUSTAIN)) {
-    if ((note[i].doScale) && (note[i].volumeScale != 1.0)) {
-      note[i].volumeNext = (byte)(logVolume[note[i].volIndex] * note[i].volumeScale);
-      if (note[i].isSample) {
-	note[i].volume = note[i].volumeNext;
-      }
-      note[i].doScale = false;
-      note[i].volumeScaled = true;
-    }
-    return;
+// The version of waveform table buf to play at phase increment inc.
+// Level L of a mipmap covers increments from MIPMAP_BASE_INC << (L-1) to
+// MIPMAP_BASE_INC << L and has no harmonics above the Nyquist frequency
+// there, so high notes do not alias. Level 0 is buf itself. Waveforms
+// without mipmaps (see MIPMAP_WAVEFORMS in the Makefile) always play buf.
+const int16_t *mipmapTable(const int16_t *buf, uint32_t inc) {
+  byte level = 0;
+  uint32_t limit = MIPMAP_BASE_INC;
+  while ((level < N_MIPMAP_LEVELS-1) && (inc >= limit)) {
+    level++;
+    limit <<= 1;
   }
-  if ((note[i].volLevelRemaining <= 0) || (note[i].volLevelRemaining > 1000)) {
-    // It is time to change the volume to the next level
-    // The check for a value above 1000 is a guard against extreme cases where
-    // the output ISR is so busy it is starving this code from checking the
-    // zero threshold and the value wraps below -32767 and becomes positive again.
-    if (note[i].volIndex == note[i].targetVolIndex) {
-      // this was the last volume level to use for this phase.
-      // switch to new phase of envelope.
-      byte phase = note[i].envelopePhase;
-      if (phase == ATTACK) {
-	byte midiChannel = note[i].midiChannel & 0x7F;
-	// switch volumeIndex to logarithmic scale for non-ATTACK phase.
-
-	byte v = note[i].volume;
-	if ((note[i].volumeScale != 1.0) && (note[i].volumeScaled)) {
-	  // the volume has already been scaled, so unscale it before 
-	  // determining the index into the release log contour.
-	  if (note[i].volumeScale > 0) {
-	    v = (byte)(v / note[i].volumeScale);
-	  } else {
-	    v = 0;
-	  }
-	  if (v > 64) {
-	    // should not happen
-	    v = 64;
-	  }
-	}
-	note[i].volIndex = inverseLogVolume[v];
-
-	if ((note[i].volumeScale != 1.0) && (!note[i].volumeScaled)) {
-	  // adjust volume in case where there was no attack.
-	  note[i].volume = (byte)(note[i].volume * note[i].volumeScale);
-	  note[i].volumeScaled = true;
-	  note[i].volumeNext = note[i].volume;
-	}
-	
-
-	// optimize for case where there is no decay
-	if (settings[midiChannel-1].sustainVolLevel == 1.0) {
-	  note[i].envelopePhase = SUSTAIN;
-	  return;
-	}
-        note[i].envelopePhase = DECAY;
-        // decay to the sustain volume which is a percentage of the original velocity
-        note[i].targetVolIndex = (byte)(settings[midiChannel-1].sustainVolLevel * note[i].targetVolIndex);
-
-	if (note[i].targetVolIndex > note[i].volIndex) {
-	  debugprint("ERROR: ", note[i].targetVolIndex);
-	  debugprintln(" > ", note[i].volIndex);
-	  note[i].volIndex = note[i].targetVolIndex;
-	}
-        note[i].volIndexInc = -1; // decreasing volume
-        note[i].volLevelDuration = settings[midiChannel-1].decayVolLevelDuration;
-        note[i].volLevelRemaining = settings[midiChannel-1].decayVolLevelDuration;
-      } else {
-        if (phase == DECAY) {
-          note[i].envelopePhase = SUSTAIN;
-        } else {
-          if (phase == RELEASE) {
-            // done with this note.
-            note[i].midiVal = NOTE_PENDING_OFF;
-	    note[i].envelopePhase = OFF;
-	    note[i].trigger = UNSET;
-          }
-        }
-      }
-    } else {
-      if ((note[i].envelopePhase == RELEASE) && (note[i].volLevelDuration == 0)) {
-	note[i].volIndex = 0;
-	note[i].volumeNext = 0;
-      } else {
-	// not yet at the target volume.
-	// Take one step closer by changing the volume.
-	note[i].volIndex += note[i].volIndexInc;
-	note[i].volLevelRemaining = note[i].volLevelDuration;
-	byte v;
-	if (note[i].envelopePhase == ATTACK) {
-	  v = attackLogVolume[note[i].volIndex];
-	} else {
-	  v = logVolume[note[i].volIndex];
-	}
-	if (note[i].volumeScale != 1.0) {
-	  // adjust volume
-	  v = (byte)(v * note[i].volumeScale);
-	  note[i].volumeScaled = true;
-	}
-	note[i].volumeNext = v;
-      }
+  if (level == 0) {
+    return buf;
+  }
+  for(byte w=0;w<nMipmapWaveforms;w++) {
+    if ((const int16_t *)pgm_read_word(&mipmapTables[w][0]) == buf) {
+      return (const int16_t *)pgm_read_word(&mipmapTables[w][level]);
     }
   }
+  return buf;
 }
-
@@ -24,7 +24,6 @@
 
 volatile unsigned int counterEnd;
 volatile unsigned long pulseClock = 0;
-int output = SILENCE;
 byte mode = MODE_SYNTH;
 
 note_t note[MAX_NOTES];
@@ -35,6 +34,12 @@ unsigned long lastDebugPrint = 0;
 
 int tuningSetting = 0;
 
+// see setOutputRate()
+byte outputRateSetting = OUTPUT_RATE_DEFAULT;
+unsigned int outputRate = 25000;
+unsigned int envelopeRateScale = 256;
+byte headroomSetting = HEADROOM_DEFAULT; // see setHeadroom()
+
 byte buttonPins[4] = {BUTTON1_PIN, BUTTON2_PIN, BUTTON3_PIN, BUTTON4_PIN};
 byte buttonState[4] = {HIGH, HIGH, HIGH, HIGH};
 byte buttonReleaseState[4] = {HIGH, HIGH, HIGH, HIGH};
@@ -44,19 +49,27 @@ byte ledState[4] = {LOW, LOW, LOW, LOW};
 uint32_t ledEventTimer[4] = {0L, 0L, 0L, 0L};
 
 // logarithmic volume scale for attack envelope contour
-byte attackLogVolume[65] = {0, 4, 8, 11, 15, 18, 21, 24, 27, 29, 31, 33, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 53, 54, 54, 55, 55, 56, 56, 57, 57, 58, 58, 58, 59, 59, 59, 60, 60, 60, 60, 61, 61, 61, 61, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 64};
+const byte attackLogVolume[256] PROGMEM = {0, 4, 7, 11, 14, 17, 21, 24, 27, 30, 33, 37, 40, 43, 46, 49, 51, 54, 57, 60, 63, 65, 68, 71, 73, 76, 78, 81, 83, 86, 88, 91, 93, 95, 97, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126, 128, 130, 132, 133, 135, 137, 139, 140, 142, 144, 145, 147, 148, 150, 151, 153, 154, 156, 157, 159, 160, 162, 163, 164, 166, 167, 168, 170, 171, 172, 173, 174, 176, 177, 178, 179, 180, 181, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 197, 198, 199, 200, 201, 202, 203, 203, 204, 205, 206, 207, 207, 208, 209, 210, 210, 211, 212, 212, 213, 214, 214, 215, 216, 216, 217, 218, 218, 219, 219, 220, 221, 221, 222, 222, 223, 223, 224, 224, 225, 226, 226, 227, 227, 228, 228, 228, 229, 229, 230, 230, 231, 231, 232, 232, 232, 233, 233, 234, 234, 235, 235, 235, 236, 236, 236, 237, 237, 237, 238, 238, 238, 239, 239, 239, 240, 240, 240, 241, 241, 241, 242, 242, 242, 242, 243, 243, 243, 244, 244, 244, 244, 245, 245, 245, 245, 246, 246, 246, 246, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 249, 249, 249, 249, 249, 250, 250, 250, 250, 250, 251, 251, 251, 251, 251, 251, 252, 252, 252, 252, 252, 252, 252, 253, 253, 253, 253, 253, 253, 253, 254, 254, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255};
 
 // maps volumes to indexes into attackLogVolume[]
-byte inverseAttackLogVolume[65] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 31, 33, 35, 37, 39, 42, 45, 49, 53, 58, 63, 64};
+const byte inverseAttackLogVolume[256] PROGMEM = {0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 24, 24, 24, 25, 25, 26, 26, 26, 27, 27, 28, 28, 28, 29, 29, 30, 30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 34, 35, 35, 36, 36, 37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 42, 42, 43, 43, 44, 44, 45, 45, 46, 46, 47, 47, 48, 48, 49, 49, 50, 50, 51, 52, 52, 53, 53, 54, 54, 55, 56, 56, 57, 57, 58, 59, 59, 60, 61, 61, 62, 63, 63, 64, 65, 65, 66, 67, 67, 68, 69, 69, 70, 71, 72, 72, 73, 74, 75, 75, 76, 77, 78, 79, 80, 80, 81, 82, 83, 84, 85, 86, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 102, 103, 104, 105, 106, 107, 109, 110, 111, 112, 114, 115, 116, 118, 119, 121, 122, 124, 125, 127, 128, 130, 132, 133, 135, 137, 139, 141, 142, 144, 146, 149, 151, 153, 155, 158, 160, 162, 165, 168, 171, 174, 177, 180, 183, 187, 190, 194, 198, 202, 207, 212, 217, 222, 228, 235, 242, 250, 255};
 
 // logarithmic volume scale for decay and release envelope contours
-byte logVolume[65] = {0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 31, 33, 35, 37, 40, 43, 46, 49, 53, 56, 60, 64};
+const byte logVolume[256] PROGMEM = {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 20, 21, 21, 22, 22, 23, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28, 29, 29, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35, 36, 36, 37, 37, 38, 39, 39, 40, 41, 41, 42, 43, 43, 44, 45, 45, 46, 47, 48, 48, 49, 50, 51, 52, 52, 53, 54, 55, 56, 57, 58, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 74, 75, 76, 77, 78, 79, 81, 82, 83, 84, 85, 87, 88, 89, 91, 92, 93, 95, 96, 98, 99, 101, 102, 104, 105, 107, 108, 110, 111, 113, 115, 116, 118, 120, 122, 123, 125, 127, 129, 131, 133, 135, 137, 139, 141, 143, 145, 147, 149, 151, 153, 155, 158, 160, 162, 164, 167, 169, 172, 174, 177, 179, 182, 184, 187, 190, 192, 195, 198, 201, 204, 206, 209, 212, 215, 218, 222, 225, 228, 231, 234, 238, 241, 244, 248, 251, 255};
+
+// Constant power pan law, 255 * cos(i/128 * pi/2). A voice at pan
+// position p plays at panGain[p] on the left and panGain[PAN_RIGHT - p]
+// on the right, so both are 180 (-3dB) at the center.
+const byte panGain[PAN_RIGHT + 1] PROGMEM = {255, 255, 255, 255, 255, 255, 254, 254, 254, 253, 253, 253, 252, 252, 251, 251, 250, 249, 249, 248, 247, 247, 246, 245, 244, 243, 242, 241, 240, 239, 238, 237, 236, 234, 233, 232, 231, 229, 228, 226, 225, 223, 222, 220, 219, 217, 215, 214, 212, 210, 208, 207, 205, 203, 201, 199, 197, 195, 193, 191, 189, 187, 185, 183, 180, 178, 176, 174, 171, 169, 167, 164, 162, 159, 157, 154, 152, 149, 147, 144, 142, 139, 136, 134, 131, 128, 126, 123, 120, 117, 115, 112, 109, 106, 103, 100, 98, 95, 92, 89, 86, 83, 80, 77, 74, 71, 68, 65, 62, 59, 56, 53, 50, 47, 44, 41, 37, 34, 31, 28, 25, 22, 19, 16, 13, 9, 6, 3, 0};
 
 // maps volumes to indexes into logVolume[]
-byte inverseLogVolume[65] = {0, 5, 10, 14, 18, 21, 24, 26, 28, 30, 32, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 52, 53, 53, 54, 54, 55, 55, 56, 56, 56, 57, 57, 57, 58, 58, 58, 59, 59, 59, 60, 60, 60, 60, 61, 61, 61, 62, 62, 62, 62, 63, 63, 63, 63, 64};
+const byte inverseLogVolume[256] PROGMEM = {0, 12, 19, 26, 32, 37, 42, 47, 52, 56, 60, 64, 67, 71, 74, 77, 80, 83, 86, 89, 92, 94, 96, 99, 101, 103, 105, 108, 110, 112, 113, 115, 117, 119, 121, 122, 124, 126, 127, 129, 130, 132, 133, 135, 136, 138, 139, 140, 142, 143, 144, 145, 147, 148, 149, 150, 151, 152, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 168, 169, 170, 171, 172, 173, 174, 174, 175, 176, 177, 178, 179, 179, 180, 181, 182, 182, 183, 184, 185, 185, 186, 187, 187, 188, 189, 189, 190, 191, 191, 192, 193, 193, 194, 195, 195, 196, 197, 197, 198, 198, 199, 200, 200, 201, 201, 202, 202, 203, 204, 204, 205, 205, 206, 206, 207, 207, 208, 208, 209, 209, 210, 210, 211, 211, 212, 212, 213, 213, 214, 214, 215, 215, 216, 216, 217, 217, 218, 218, 219, 219, 220, 220, 220, 221, 221, 222, 222, 223, 223, 224, 224, 224, 225, 225, 226, 226, 226, 227, 227, 228, 228, 228, 229, 229, 230, 230, 230, 231, 231, 232, 232, 232, 233, 233, 233, 234, 234, 235, 235, 235, 236, 236, 236, 237, 237, 237, 238, 238, 238, 239, 239, 240, 240, 240, 241, 241, 241, 242, 242, 242, 243, 243, 243, 244, 244, 244, 244, 245, 245, 245, 246, 246, 246, 247, 247, 247, 248, 248, 248, 249, 249, 249, 249, 250, 250, 250, 251, 251, 251, 252, 252, 252, 252, 253, 253, 253, 254, 254, 254, 254, 255};
 
 
-float noteTable[(MIDI_HIGH-MIDI_LOW)+1];
+// phase increments of the notes from PITCH_TOP_OCTAVE, see pitchIncrement()
+uint32_t waveSemitoneInc[12];
+uint32_t sampleSemitoneInc[12];
+int tuningPitch = BASE_TUNING_PITCH;
 
 byte ATTACK_TIME_POT;
 byte DECAY_TIME_POT;
@@ -99,10 +112,11 @@ int lastFilterCutoffReading;
 int lastFilterResonanceReading = 255;
 
 boolean lfoEnabled[NUM_LFO] = {false, false};
-boolean lastLFOEnabled[NUM_LFO] = {false, false};
+boolean lastFilterCutoffModulated = false;
 int lastLFORateReading[NUM_LFO] = {0, 0};
 int lastLFODepthReading[NUM_LFO] = {0, 0};
 int lastLFOWaveformReading;
+int lastPitchPeak = 0;
 
 int lastBPMReading;
 int lastArpNoteLengthReading;
@@ -172,12 +186,8 @@ void loop(void) {
 #ifdef DEBUG_ENABLE
   doDebug();
 #endif
-#ifdef MIDI_ENABLE
-  while (MIDI.read());
-#endif
-#ifdef USBMIDI_ENABLE
-  while (USBMIDI.read());
-#endif
+  readMIDI();
+  saveChangedGlobalSettings();
 
   updateMIDIClockInfo();
 
@@ -192,17 +202,8 @@ void loop(void) {
       for(byte i=0;i<N_NOTE_BUTTONS;i++) {
 	byte noteIndex = button[i].noteIndex;
 	if ((noteIndex != UNSET) && (note[noteIndex].trigger == i)) {
-	  note[noteIndex].waveformBuf = waveformBuffers[settings[selectedSettings].waveform];
-	  note[noteIndex].phase = 0;
-	  note[noteIndex].phaseInc = 0;
-	  note[noteIndex].lastFrequency = 0.0;
-	  if (settings[selectedSettings].waveform >= N_WAVEFORMS) {
-	    note[noteIndex].isSample = true;
-	    note[noteIndex].sampleLength = sampleLength[settings[selectedSettings].waveform - N_WAVEFORMS];
-	  } else {
-	    note[noteIndex].isSample = false;
-	  }
 	  note[noteIndex].midiChannel = selectedSettings+1;
+	  setNoteWaveform(noteIndex, settings[selectedSettings].waveform);
 	}
       }
       ledState[selectedSettings] = HIGH;
@@ -217,17 +218,16 @@ void loop(void) {
 	detunePotTolerance = 2;
 	settings[selectedSettings].detuneReading = reading;
 	if ((reading > 365) && (reading < 565)) {
-	  fSetting = 0.0;
+	  setting = 0;
 	} else {
 	  if (reading <=365) {
 	    // lower half of pot
-	    setting = -(map(reading, 0, 365, 1024, 0));
+	    setting = -(map(reading, 0, 365, 256, 0));
 	  } else {
-	    setting = map(reading, 565, 1023, 0, 1024);
+	    setting = map(reading, 565, 1023, 0, 256);
 	  }
-	  fSetting = setting / 1024.0; // range is [-1.0, 1.0]
 	}
-	settings[selectedSettings].detune = fSetting;
+	settings[selectedSettings].detune = setting; // up to a semitone
       }
     }
 
@@ -305,8 +305,9 @@ void loop(void) {
       filterCutoffPotTolerance = 0;
       filterCutoffReading = reading;
       lastFilterCutoffReading = reading;
-      if (!lfoEnabled[LFO_FILTER]) {
-	// Only use the knob reading if the LFO is not modulating the filter.
+      if (!filterCutoffModulated) {
+	// Only use the knob reading if the LFO or the modulation matrix
+	// is not modulating the filter.
 	filterCutoff = filterCutoffReading;
 	setFilterFeedback();
       }
@@ -323,8 +324,7 @@ void loop(void) {
       track[currentTrack].volumeScale = (float)reading / 1023.0;
       for(byte i=0;i<MAX_NOTES;i++) {
 	if ((note[i].trigger == currentTrack) || (note[i].isPreview) || (!seqRunning)) {
-	  note[i].volumeScale = track[currentTrack].volumeScale;
-	  note[i].doScale = true;
+	  note[i].volumeScale = (byte)(track[currentTrack].volumeScale * MAX_NOTE_VOL);
 	}
       }
     }
@@ -434,8 +434,9 @@ void loop(void) {
 	filterCutoffPotTolerance = 0;
 	filterCutoffReading = reading;
 	lastFilterCutoffReading = reading;
-	if (!lfoEnabled[LFO_FILTER]) {
-	  // Only use the knob reading if the LFO is not modulating the filter.
+	if (!filterCutoffModulated) {
+	  // Only use the knob reading if the LFO or the modulation matrix
+	  // is not modulating the filter.
 	  filterCutoff = filterCutoffReading;
 	  setFilterFeedback();
 	}
@@ -471,19 +472,20 @@ void loop(void) {
       lastLFORateReading[lfoNum] = reading;
       if (reading > 0) {
 	if (!lfoEnabled[lfoNum]) {
-	  // reset the LFO phase
-	  lfoPhase[lfoNum] = 0;
+	  resetLFO(lfoNum);
 	}
 	lfoEnabled[lfoNum] = true;
+	// frequency in 1/16Hz
 	if (reading < 512) {
-	  lfoFrequency[lfoNum] = reading / 25.55;    // map to frequency in range [0.0, 20.0]
+	  lfoFrequency[lfoNum] = ((long)reading * 160) >> 8;    // map to frequency in range [0.0, 20.0]
 	} else {
-	  lfoFrequency[lfoNum] = 20.0 + ((reading-512) / 1.2775);    // map to frequency in range [20.0, 420.0]
+	  lfoFrequency[lfoNum] = 320 + (((long)(reading-512) * 801) >> 6);    // map to frequency in range [20.0, 420.0]
 	}
+	updateLFO(lfoNum);
       } else {
 	lfoEnabled[lfoNum] = false;
       }
-      if (lfoDepth[lfoNum] == 0.0) {
+      if (lfoDepth[lfoNum] == 0) {
 	// since the rate pot was moved, force reading of depth pot.
 	lastLFODepthReading[lfoNum] = 0;
       }
@@ -494,93 +496,65 @@ void loop(void) {
     diff = abs(reading - lastLFODepthReading[lfoNum]);
     if (diff > lfoDepthPotTolerance) {
       lfoDepthPotTolerance = 0;
-      lfoDepth[lfoNum] = setting / 2048.0;  // 0.0-0.5
+      lfoDepth[lfoNum] = setting;  // 0.0-0.5 of 2048
     }
   } // read pots if MODE_SYNTH or MODE_ARPEGGIATOR
 
 
-  for(byte lfo=0;lfo<NUM_LFO;lfo++) {
-    if (lfoEnabled[lfo]) {
-      updateLFO(lfo);
-    }
+  // The LFOs and the modulation matrix run in the output ISR, see
+  // advanceLFOs() and advanceModulation().
+  boolean cutoffModulated = filterCutoffModulated;
+  if ((!cutoffModulated) && (lastFilterCutoffModulated)) {
+    // The filter LFO or the last cutoff route has just been disabled,
+    // so revert back to the knob setting.
+    filterCutoff = filterCutoffReading;
+    setFilterFeedback();
   }
+  lastFilterCutoffModulated = cutoffModulated;
 
-  if (lfoEnabled[LFO_FILTER]) {
-    filterCutoff = filterCutoffReading + ((int)(128.0 * (lfoShift[LFO_FILTER] * lfoDepth[LFO_FILTER])));
-    filterCutoff = constrain(filterCutoff, 0, 255);
-    setFilterFeedback();
-  } else {
-    if (lastLFOEnabled[LFO_FILTER]) {
-      // The filter LFO has just been disabled, so revert back to the knob setting.
-      filterCutoff = filterCutoffReading;
-      setFilterFeedback();
+  // the pitch LFO and the modulation matrix take render time
+  updateVoiceLimit();
+
+  // the mipmap of a note depends on how far the pitch LFO and the pitch
+  // routes can take it
+  int pitchPeak = lfoPitchPeak() + modPitchPeak;
+  if (pitchPeak != lastPitchPeak) {
+    lastPitchPeak = pitchPeak;
+    for(byte i=0;i<MAX_NOTES;i++) {
+      note[i].lastPitch = 0;
     }
   }
 
-  lastLFOEnabled[LFO_PITCH] = lfoEnabled[LFO_PITCH];
-  lastLFOEnabled[LFO_FILTER] = lfoEnabled[LFO_FILTER];
-  
   for(byte i=0;i<MAX_NOTES;i++) {
+    if ((note[i].midiVal > NOTE_PENDING_OFF) && (voiceEnded(i))) {
+      // the output ISR played a sample to its end, or the release of
+      // the envelope ended
+      note[i].midiVal = NOTE_OFF;
+      note[i].envelopePhase = OFF;
+      note[i].trigger = UNSET;
+      moveVoice(i, VOICE_LIST_FREE);
+    }
     if (note[i].midiVal > NOTE_PENDING_OFF) {
       if (mode == MODE_SYNTH) {
 	byte midiChannel = note[i].midiChannel & 0x7F;
 	ledState[midiChannel-1] = HIGH;
       }
-      note[i].frequency = noteTable[note[i].midiVal-MIDI_LOW];
-
-      processEnvelope(i);
-
-      // Adjust each note frequency for detune.
-      if (!note[i].isSample) {
-	float detune = settings[(note[i].midiChannel & 0x7F)-1].detune;
-	// detune is in range [-1.0, 1.0]
-	if (detune != 0.0) {
-	  // Adjust the frequency of the note by up to 1 semitone.
-	  float f = note[i].frequency;
-	  byte n2;
-	  float delta; // amount of frequency shift
-	  if (detune < 0.0) {
-	    n2 = max(MIDI_LOW, (note[i].midiVal - 1));
-	    delta = (f - noteTable[n2-MIDI_LOW]) * detune;
-	  } else {
-	    n2 = min(MIDI_HIGH, (note[i].midiVal + 1));
-	    delta = (noteTable[n2-MIDI_LOW] - f) * detune;
-	  }
-	  note[i].frequency += delta;
-	}
-      }
+      int pitch = note[i].midiVal << PITCH_FRACTION_BITS;
 
-
-      // Adjust each note frequency for pitch bend.
+      // Adjust the pitch of each note for detune and pitch bend. They
+      // add in semitones, so this is integer math.
       if (!note[i].isSample) {
-	int bend = settings[(note[i].midiChannel & 0x7F)-1].pitchBend;
-	// bend is in range [-8192, 8191]
-	if (bend != 0) {
-	  // Adjust the frequency of the note. Pitch bend range is +/-2 semitones.
-	  float f = note[i].frequency;
-	  byte n2;
-	  float delta; // amount of frequency shift per unit of bend
-	  if (bend < 0) {
-	    n2 = max(MIDI_LOW, (note[i].midiVal - 2));
-	    delta = (f - noteTable[n2-MIDI_LOW]) / 8192.0;
-	  } else {
-	    n2 = min(MIDI_HIGH, (note[i].midiVal + 2));
-	    delta = (noteTable[n2-MIDI_LOW] - f) / 8191.0;
-	  }
-	  note[i].frequency += (delta * bend);
-	}
-      }
-
-      // Adjust each note frequency for the LFO effect.
-      if (lfoEnabled[LFO_PITCH]) {
-	if (!note[i].isSample) {
-	  note[i].frequency += note[i].frequency * (lfoShift[LFO_PITCH] * lfoDepth[LFO_PITCH]);
-	}
+	settings_t *s = &settings[(note[i].midiChannel & 0x7F)-1];
+	// detune is up to 1 semitone
+	pitch += s->detune;
+	// bend is in range [-8192, 8191], +/-2 semitones
+	pitch += s->pitchBend / 16;
       }
-
+      note[i].pitch = pitch;
 
       setPhaseIncrement(i);
     }
+    updateVoice(i);
   }
 
   for(byte i=0;i<4;i++) {
@@ -599,21 +573,32 @@ void setWaveform(byte settingsIndex, byte waveformIndex) {
 	changeWaveform = false;
       }
       if (changeWaveform) {
-	note[i].waveformBuf = waveformBuffers[settings[settingsIndex].waveform];
-	note[i].phase = 0;
-	note[i].phaseInc = 0;
-	note[i].lastFrequency = 0.0;
-	if (settings[settingsIndex].waveform >= N_WAVEFORMS) {
-	  note[i].isSample = true;
-	  note[i].sampleLength = sampleLength[settings[settingsIndex].waveform - N_WAVEFORMS];
-	} else {
-	  note[i].isSample = false;
-	}
+	setNoteWaveform(i, settings[settingsIndex].waveform);
       }
     }
   }
 }
 
+// Give note i a new waveform. A voice that is already playing, even in
+// its release, swaps the waveform with VOICE_CMD_SET_WAVEFORM once loop()
+// has set the phase increment for it, and keeps its envelope. Starting
+// it again would restart the envelope with no release to follow.
+void setNoteWaveform(byte i, byte waveformIndex) {
+  note[i].waveformBuf = waveformBuffers[waveformIndex];
+  note[i].phaseInc = 0;
+  note[i].lastPitch = 0;
+  if (waveformIndex >= N_WAVEFORMS) {
+    note[i].isSample = true;
+    note[i].sampleLength = sampleLength[waveformIndex - N_WAVEFORMS];
+  } else {
+    note[i].isSample = false;
+  }
+  selectKernel(i);
+  if (note[i].started) {
+    note[i].waveformPending = true;
+  }
+}
+
 void setPotReadings() {
   byte lfoNum;
   if (!fnEnabled) {
@@ -57,20 +57,51 @@
 #define POT_MIDI_HIGH 72
 #define N_MIDI_CHANNELS 4
 #define N_SETTINGS 4
+#define PHASE_FRACTION_BITS 16 // fractional bits in voice phase and phaseInc
 #define NOTE_OFF 0
 #define NOTE_PENDING_OFF 1
-#define MAX_NOTES 5
-#define MAX_NOTE_VOL 64
+#define MAX_NOTES 8 // at most 8, see activeVoiceMask
+#define MAX_NOTE_VOL 255
+#define VOL_STEP_SHIFT 2 // envelope durations are in 1/(1 << VOL_STEP_SHIFT) samples per step
 #define N_NOTE_BUTTONS 3
 #define LFO_PITCH 0
 #define LFO_FILTER 1
 #define NUM_LFO 2
 #define UNSET 255
 #define MAX_VELOCITY 50
-#define OUTPUT_RATE 25000
-#define LFO_CLOCK_RATE 1000
+// Output sample rates, selected by outputRateSetting (saved with the
+// global settings, see setOutputRate()). The default is 0 so a cleared
+// EEPROM selects it.
+#define OUTPUT_RATE_DEFAULT 0 // 25KHz
+#define OUTPUT_RATE_LOW 1     // 16KHz, more time for voices
+#define OUTPUT_RATE_HIGH 2    // 32KHz, more bandwidth
+#define N_OUTPUT_RATES 3
+#define SAMPLE_RATE 25000 // rate the drum samples were recorded at
+#define AUDIO_BLOCK_SIZE 32 // samples rendered per DMA buffer, 32 or 64
+#ifdef STEREO_OUTPUT
+#define AUDIO_CHANNELS 2 // DACB channel 0 is left, channel 1 right
+#else
+#define AUDIO_CHANNELS 1
+#endif
+#define AUDIO_FRAME_BYTES (AUDIO_CHANNELS * 2) // DMA bytes per output sample
+// Stereo positions of voices, see panGain[]. MIDI pan 127 is taken as
+// PAN_RIGHT so the range has a center.
+#define PAN_LEFT 0
+#define PAN_CENTER 64
+#define PAN_RIGHT 128
+#define MIX_BUS_FRACTION_BITS 3 // bits below the DAC LSB on the output bus, see busSample()
+#define HEADROOM_DEFAULT 4 // voices that play at full level, see setHeadroom()
+// Output filter modes, see filterSample(). The legacy mode is the
+// original resonant low pass filter, the others the state variable
+// filter.
+#define FILTER_MODE_LEGACY 0
+#define FILTER_MODE_LOWPASS 1
+#define FILTER_MODE_HIGHPASS 2
+#define FILTER_MODE_BANDPASS 3
+#define FILTER_MODE_NOTCH 4
+#define N_FILTER_MODES 5
+#define LFO_FREQUENCY_FRACTION_BITS 4 // lfoFrequency is in 1/16Hz
 #define RESET_PRESS_DURATION 2000
-#define NOISE_BUF_LEN 1024
 
 #define ARP_MAX_NOTES 16
 #define DEFAULT_BPM 120
@@ -100,52 +131,178 @@
 #define METRONOME_MODE_QUARTER 1
 #define METRONOME_MODE_SIXTEENTH 2
 
-#define BASE_TUNING_ADJUSTMENT -0.50
+// Pitch is in semitones (MIDI note numbers) with PITCH_FRACTION_BITS
+// fractional bits, so detune, pitch bend, LFO and tuning add to it. See
+// pitchIncrement().
+#define PITCH_FRACTION_BITS 8
+#define PITCH_TOP_OCTAVE 132 // first note of the octave in the increment tables
+#define BASE_TUNING_PITCH -128 // half a semitone flat
+#define LFO_PITCH_RANGE 4430 // pitch at full LFO shift and depth 1.0, about 17 semitones
 
-// constants for envelope phase
+// constants for envelope phase. The envelope runs in the output ISR,
+// see advanceEnvelope().
 #define ATTACK 0
 #define SUSTAIN 1
 #define DECAY 2
 #define RELEASE 3
 #define OFF 4
 
+// render kernels for the voice types, index into renderKernels[]
+#define KERNEL_WAVETABLE 0
+#define KERNEL_SAMPLE 1
+#define KERNEL_NOISE 2
+#define KERNEL_WAVETABLE_LERP 3 // interpolating, see settings_t.interpolate
+#define KERNEL_SAMPLE_LERP 4
+#define KERNEL_NOISE_PINK 5 // see settings_t.noiseColor
+#define KERNEL_NOISE_BROWN 6
+#define N_KERNELS 7
+
+// settings_t.noiseColor
+#define NOISE_WHITE 0
+#define NOISE_PINK 1
+#define NOISE_BROWN 2
+#define N_NOISE_COLORS 3
+#define NOISE_MAX_INC 0xFFFF // a new noise value every sample, see setPhaseIncrement()
+
+// set in the saved waveform byte when the channel interpolates
+#define WAVEFORM_INTERPOLATE_BIT 0x80
+
+// voice commands from the control code to the output ISR, see voiceCommand_t
+#define VOICE_CMD_START 0
+#define VOICE_CMD_RELEASE 1
+#define VOICE_CMD_STOP 2
+#define VOICE_CMD_SET_INC 3
+#define VOICE_CMD_SET_GAIN 4
+#define VOICE_CMD_SET_WAVEFORM 5
+#define VOICE_QUEUE_SIZE 16 // per producer, power of 2
+#define VOICE_QUEUE_RESERVE 4 // slots that parameter updates may not use
+#define STEAL_FADE_SAMPLES 32 // fade out time of a stolen voice
+#define MIDI_LATENCY 256 // samples from MIDI arrival to the note, see midiEventTime()
+
+// voice allocation lists, see moveVoice()
+#define VOICE_LIST_FREE 0
+#define VOICE_LIST_RELEASING 1
+#define VOICE_LIST_ACTIVE 2
+#define VOICE_LIST_PARKED 3 // voices above voiceLimit
+#define N_VOICE_LISTS 4
+
+// settings_t.voiceFilterCutoff of a channel whose voices are not filtered
+#define VOICE_FILTER_OFF 255
+
+// Modulation matrix, see modulation.cpp
+#define N_MOD_SLOTS 4
+// sources, 0..127 or -128..127 for the LFOs and the key
+#define MOD_SRC_NONE 0
+#define MOD_SRC_LFO_PITCH 1  // waveform of the pitch LFO, whatever its depth
+#define MOD_SRC_LFO_FILTER 2
+#define MOD_SRC_ENVELOPE 3   // of each voice
+#define MOD_SRC_VELOCITY 4   // of each voice
+#define MOD_SRC_KEY 5        // of each voice, from middle C
+#define MOD_SRC_MOD_WHEEL 6
+#define MOD_SRC_AFTERTOUCH 7
+#define N_MOD_SOURCES 8
+// destinations
+#define MOD_DST_PITCH 0      // of each voice, up to an octave
+#define MOD_DST_CUTOFF 1     // output filter, or voice filters from voice sources
+#define MOD_DST_RESONANCE 2  // output filter
+#define MOD_DST_AMPLITUDE 3  // of each voice
+#define MOD_DST_PAN 4        // of each voice, STEREO_OUTPUT builds
+#define MOD_DST_WAVEFORM 5   // waveform a note starts with
+#define N_MOD_DESTINATIONS 6
+// routes of voice sources to MOD_DST_CUTOFF go to the voice filters
+#define MOD_DST_VOICE_CUTOFF 6
+#define N_MOD_ROUTE_LISTS 7
+
+// voice stealing policies, used when every voice is busy
+#define STEAL_OLDEST 0
+#define STEAL_QUIETEST 1
+#define STEAL_LOWEST_VELOCITY 2
+#define STEAL_SAME_NOTE 3       // retrigger a voice playing the same note
+#define STEAL_PROTECT_SAMPLES 4 // oldest, but samples last
+#define N_STEAL_POLICIES 5
+
 #define POT_LOCK_TOLERANCE 5
 #define POT_MIN 2
 #define ATTACK_RANGE 500
 #define DECAY_RANGE 500
 #define RELEASE_RANGE 500
 
+// One sample of the mix bus: the sum of the full voice sample times
+// volume products, see renderBlock().
+typedef __int24 mix_t;
+
 typedef struct {
   volatile byte midiVal;
   byte origMidiVal; // used for channel 10 drums
-  volatile float frequency;
-  float lastFrequency;
+  volatile int pitch; // see PITCH_FRACTION_BITS
+  int lastPitch; // 0 when the phase increment has to be computed
   byte waveform;
   const int16_t *waveformBuf;
+  const int16_t *tableBuf; // waveformBuf, or its mipmap for the pitch
+  byte kernel;
   boolean isSample;
   boolean isPreview;
   unsigned int sampleLength;
-  int volLevelDuration;
-  volatile int volLevelRemaining;
-  byte envelopePhase;
-  byte volIndex;
-  byte targetVolIndex;
-  int volIndexInc;
+  uint32_t startTime; // sampleCount to start the voice at, see scheduleNote()
+  uint32_t releaseTime; // sampleCount to start the release at
+  byte envelopePhase; // ATTACK until the note is released
+  // Envelope of the voice, sent with its start command. Levels are
+  // indexes into logVolume[], steps are per block, see envelopeInc().
+  byte peakIndex;
+  byte sustainIndex;
+  unsigned int attackInc; // 0 to start at the peak
+  unsigned int decayInc;
   byte midiChannel;
   byte trigger;
-  unsigned long startTime;
-  byte volume;
-  byte volumeNext;
-  float volumeScale;
-  volatile boolean volumeScaled;
-  boolean doScale;
-  volatile unsigned int phase;
-  volatile unsigned int phaseInc;
-  volatile byte phaseFraction;
-  volatile byte phaseFractionInc;
-  volatile int lastOutput;
+  byte velocity;
+  byte volumeScale; // track fader, MAX_NOTE_VOL is full volume
+  byte pan; // PAN_LEFT..PAN_RIGHT, used by STEREO_OUTPUT builds
+  byte filterCutoff; // voice filter with key tracking, or VOICE_FILTER_OFF
+  byte filterEnvelope;
+  uint32_t phaseInc; // 16.16 fixed point
+  // State of the matching voice in the output ISR, see updateVoice()
+  boolean started;
+  boolean stopPending;
+  boolean releasePending;
+  boolean waveformPending; // the waveform changed while the voice was playing
+  // release envelope step, or for a sample the part of the rest of
+  // it to play, of 256
+  unsigned int releaseValue;
+  byte startCount;
+  uint32_t sentPhaseInc;
+  byte sentVolumeScale;
+#ifdef DEBUG_ENABLE
+  uint32_t requestTime; // sampleCount when the note was requested
+#endif
 } note_t;
 
+// A command for one voice, queued by sendVoiceCommand() and applied by
+// the output ISR at the start of a block.
+typedef struct {
+  byte type;
+  byte voice;
+  byte seq;         // order the commands were queued in, see drainVoiceQueues()
+  byte kernel;      // VOICE_CMD_START, VOICE_CMD_SET_WAVEFORM
+  byte volumeScale; // VOICE_CMD_START, VOICE_CMD_SET_GAIN
+  byte startCount;  // VOICE_CMD_START
+  byte pan;         // VOICE_CMD_START
+  byte velocity;    // VOICE_CMD_START, 0..127 for the modulation matrix
+  byte key;         // VOICE_CMD_START, MIDI note
+  byte filterCutoff; // VOICE_CMD_START, the voice filter, see note_t
+  byte filterEnvelope;
+  const int16_t *waveformBuf; // VOICE_CMD_START, VOICE_CMD_SET_INC, VOICE_CMD_SET_WAVEFORM
+  unsigned int sampleLength;  // VOICE_CMD_START, VOICE_CMD_SET_WAVEFORM
+  byte peakIndex;   // VOICE_CMD_START, the envelope, see note_t
+  byte sustainIndex;
+  unsigned int attackInc;
+  unsigned int decayInc;
+  uint32_t value;   // phase increment, or release value for VOICE_CMD_RELEASE
+  uint32_t startTime; // sampleCount to start the voice at, or the release
+#ifdef DEBUG_ENABLE
+  uint32_t requestTime; // VOICE_CMD_START
+#endif
+} voiceCommand_t;
+
 typedef struct {
   byte waveform;
   int attackVolLevelDuration;
@@ -153,7 +310,12 @@ typedef struct {
   float sustainVolLevel;
   int releaseVolLevelDuration;
   int pitchBend;
-  float detune;
+  int detune; // [-256, 256], up to a semitone of pitch
+  boolean interpolate; // interpolate between table entries, saved with the waveform
+  byte pan; // PAN_LEFT..PAN_RIGHT, not saved
+  byte voiceFilterCutoff; // filter on each voice, VOICE_FILTER_OFF for none, not saved
+  byte voiceFilterEnvelope; // how far the envelope opens the voice filter, not saved
+  byte noiseColor; // spectrum of the noise waveform, NOISE_WHITE.., not saved
   int waveformReading;
   int attackReading;
   int decayReading;
@@ -184,8 +346,31 @@ typedef struct {
   byte state;
   float volumeScale; // scaling for track fader. value is 0.0-1.0
 } sequenceTrack_t;
+
+// One slot of the modulation matrix
+typedef struct {
+  byte source;
+  byte destination;
+  int8_t amount; // of 127
+} modSlot_t;
+
+// A route of a modulation destination, see setModRouting()
+typedef struct {
+  byte source;
+  int8_t amount;
+} modRoute_t;
+
+// Output filter state of one channel
+typedef struct {
+  long buf0; // legacy low pass filter
+  long buf1;
+  int low; // state variable filter, half the output bus scale
+  int band;
+} filterState_t;
   
-extern float noteTable[];
+extern uint32_t waveSemitoneInc[];
+extern uint32_t sampleSemitoneInc[];
+extern int tuningPitch;
 extern byte ATTACK_TIME_POT;
 extern byte DECAY_TIME_POT;
 extern byte SUSTAIN_LEVEL_POT;
@@ -207,18 +392,32 @@ extern byte FILTER_CUTOFF_POT;
 extern byte FILTER_RESONANCE_POT;
 
 extern volatile unsigned int counterEnd;
-extern int output;
+extern volatile unsigned int kernelCycles[];
+extern volatile unsigned int filteredKernelCycles[];
+extern volatile unsigned int outputCycles;
+extern volatile unsigned int maxNoteOnLatency;
 extern volatile unsigned long pulseClock;
 extern byte mode;
 extern note_t note[];
+extern volatile byte activeVoices[];
+extern volatile byte nActiveVoices;
+extern volatile byte activeVoiceMask;
+extern volatile byte voiceStartCount[];
+extern uint16_t audioBuf[2][AUDIO_BLOCK_SIZE * AUDIO_CHANNELS];
 extern settings_t settings[];
 extern byte selectedSettings;
+extern byte stealPolicy;
 extern button_t button[];
 extern int tuningSetting;
-extern byte logVolume[];
-extern byte attackLogVolume[];
-extern byte inverseAttackLogVolume[];
-extern byte inverseLogVolume[];
+extern byte outputRateSetting;
+extern byte headroomSetting;
+extern unsigned int outputRate;
+extern unsigned int envelopeRateScale;
+extern const byte logVolume[] PROGMEM;
+extern const byte attackLogVolume[] PROGMEM;
+extern const byte inverseAttackLogVolume[] PROGMEM;
+extern const byte inverseLogVolume[] PROGMEM;
+extern const byte panGain[] PROGMEM;
 extern byte led[];
 extern byte ledState[];
 extern uint32_t ledEventTimer[];
@@ -257,22 +456,26 @@ extern byte filterResonancePotTolerance;
 
 extern int filterCutoff;
 extern int filterResonance;
+extern byte filterMode;
+extern int8_t filterResonanceMod;
+extern volatile boolean filterCutoffModulated;
 extern long feedback;
-extern int buf0;
-extern int buf1;
-extern int noiseBuf[];
-extern volatile unsigned int noiseBufIndex;
-extern volatile byte noiseUpdateCount;
-extern unsigned int noiseBufUpdateIndex;
-
-extern float lfoFrequency[];
-extern float lfoDepth[];
-extern float lfoShift[];
+extern unsigned int svfF;
+extern unsigned int svfQ;
+extern filterState_t filterState[];
+
+extern unsigned int lfoFrequency[];
+extern unsigned int lfoDepth[];
 extern byte lfoWaveform;
-extern volatile unsigned int lfoPhase[];
-extern volatile unsigned int lfoPhaseInc[];
-extern volatile byte lfoPhaseFraction[];
-extern volatile byte lfoPhaseFractionInc[];
+extern int lfoPitchMod[];
+extern boolean lfoPitchModOn;
+extern int lfoLevel[];
+extern modSlot_t modSlot[];
+extern byte selectedModSlot;
+extern volatile int8_t modSource[];
+extern modRoute_t modRoutes[][N_MOD_SLOTS];
+extern byte nModRoutes[];
+extern int modPitchPeak;
 extern const int16_t *lfoWaveformBuf;
 extern boolean lfoEnabled[];
 
@@ -318,6 +521,7 @@ extern boolean midiClock;
 
 // Function Prototypes
 void hardwareInit();
+void initAudioDMAChannel(DMA_CH_t *, uint16_t *);
 void reset(boolean);
 void test();
 void adjustTuning();
@@ -328,21 +532,30 @@ void handleNoteOff(byte, byte, byte);
 void handleProgramChange(byte, byte);
 void handleControlChange(byte, byte, byte);
 void handlePitchBend(byte, int);
+void handleAfterTouch(byte, byte);
 void handleStart();
 void handleContinue();
 void handleStop();
 void handleSystemReset();
 void handleClock();
 void updateMIDIClockInfo();
+void readMIDI();
+uint32_t midiEventTime();
 byte doNoteOn(byte, byte, byte);
-void doNoteOff(byte, byte);
+void doNoteOff(byte, byte, uint32_t);
 void releaseNote(note_t *);
+void scheduleNote(byte, uint32_t);
+void scheduleRelease(note_t *, uint32_t);
 void stopNote(byte);
-void doDrumNoteOff(byte);
+void doDrumNoteOff(byte, uint32_t);
 void setDrumParameters(byte, byte, byte);
 void eepromClear();
+void setOutputRate(byte);
+void setHeadroom(byte);
 void readGlobalSettings();
 void writeGlobalSettings();
+void globalSettingsChanged();
+void saveChangedGlobalSettings();
 void loadPatch(byte);
 void savePatch(byte);
 boolean patchValid(byte);
@@ -375,18 +588,41 @@ void setMIDIArpeggioNotes();
 
 void setBPM(unsigned int);
 void setWaveform(byte, byte);
+void setNoteWaveform(byte, byte);
 void setPotReadings();
 void setPhaseIncrement(byte);
-void processEnvelope(byte);
-int adjustAmplitude(int, byte);
+uint32_t pitchIncrement(const uint32_t *, int);
+unsigned int pitchRatio(int);
+const int16_t *mipmapTable(const int16_t *, uint32_t);
+unsigned int envelopeInc(int);
+byte voiceVolume(byte);
+void renderBlock(byte);
+void selectKernel(byte);
+boolean sendVoiceCommand(byte, byte);
+void updateVoice(byte);
+boolean voiceEnded(byte);
+uint32_t getSampleCount();
+uint32_t getSampleTime();
+void holdAudio();
 byte metronomeTick(byte, byte);
 void initNote(byte, byte);
-byte findNoteIndex();
+void startNoteNow(byte);
+byte findNoteIndex(byte, byte);
+void initVoiceLists();
+void moveVoice(byte, byte);
+void setVoiceLimit(byte);
+void updateVoiceLimit();
 void setFilterFeedback();
 
 void updateLFO(byte);
-void updateNoise();
-void initNoise();
+void resetLFO(byte);
+int lfoPitchPeak();
+void advanceLFOs();
+void clearModMatrix();
+void setModRouting();
+void advanceModulation();
+int modulation(byte, int8_t, int8_t, int8_t);
+byte modulatedWaveform(byte, byte, byte);
 
 int sampledAnalogRead(int);
 boolean buttonPressed(byte);
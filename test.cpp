@@ -72,11 +72,12 @@ void tone(byte midiVal) {
     initNote(0, midiVal);
     n->waveform = 1;
     n->waveformBuf = waveformBuffers[1];
-    n->volume = MAX_NOTE_VOL;
-    n->volumeNext = MAX_NOTE_VOL;
+    n->peakIndex = MAX_NOTE_VOL;
+    selectKernel(0);
   }
-  n->frequency = 440.0 * (pow(2, ((midiVal-69))/12.0));
+  n->pitch = midiVal << PITCH_FRACTION_BITS;
   setPhaseIncrement(0);
+  updateVoice(0);
 }
 
 int readPots() {
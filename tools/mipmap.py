@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+#
+#  Synthino polyphonic synthesizer
+#  Copyright (C) 2014-2015 Michael Krumpus
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Generate band-limited mipmaps of the single cycle waveforms.
+
+Usage: mipmap.py [-o waveforms/mipmaps.cpp] [waveform ...]
+
+Level 0 of a waveform is its table in waveforms/ as it is. Level L plays
+phase increments from MIPMAP_BASE_INC << (L-1) up to MIPMAP_BASE_INC << L
+and keeps only the harmonics that stay below the Nyquist frequency at the
+top of that range, so every level has half the harmonics of the one below
+it. Because the limit depends on the phase increment and not on the
+frequency, the tables suit any output rate.
+
+The named waveforms get mipmaps, the others play their level 0 table at
+every pitch. A report of the flash each level costs, and of how much of
+each waveform lies above each level's limit, goes to stdout so the list
+in the Makefile can be chosen with numbers in hand.
+"""
+
+import math
+import os
+import re
+import sys
+
+from wavetable import ROOT, read_define, read_table, spectrum, synthesize
+
+
+def read_waveform_names(n_waveforms):
+    """The single cycle waveforms in waveformBuffers[] order, None for noise."""
+    with open(os.path.join(ROOT, "waveforms.cpp"), encoding="latin-1") as f:
+        text = f.read()
+    body = re.search(r"waveformBuffers\[[^]]*\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    names = [re.sub(r"//.*", "", line).strip().rstrip(",") for line in body.splitlines()]
+    names = [n for n in names if n]
+    return [None if n == "NULL" else n for n in names[:n_waveforms]]
+
+
+def harmonic_limit(level, n_samples, base_inc):
+    # harmonic h folds over when h * increment > n_samples / 2
+    return int((n_samples // 2) * 65536 // (base_inc << level))
+
+
+def energy_above(bins, harmonics):
+    total = sum(abs(b) ** 2 for b in bins[1:])
+    above = sum(abs(b) ** 2 for b in bins[harmonics + 1:])
+    if total == 0 or above == 0:
+        return None
+    return 10.0 * math.log10(above / total)
+
+
+def write_tables(path, names, levels, tables, n_samples):
+    with open(path, "w") as f:
+        f.write("// Band-limited wavetable mipmaps, generated by tools/mipmap.py.\n")
+        f.write("// Do not edit, change MIPMAP_WAVEFORMS in the Makefile instead.\n\n")
+        f.write("#include <avr/pgmspace.h>\n")
+        f.write('#include "waveforms.h"\n\n')
+        for name in names:
+            for level in range(1, levels):
+                f.write("const int16_t %s_mip%d[N_WAVEFORM_SAMPLES] PROGMEM = {\n" % (name, level))
+                for s in range(0, n_samples, 10):
+                    row = tables[name][level][s:s + 10]
+                    f.write("  " + ", ".join("%d" % v for v in row) + ",\n")
+                f.write("};\n\n")
+        f.write("const int16_t * const mipmapTables[][N_MIPMAP_LEVELS] PROGMEM = {\n")
+        if not names:
+            f.write("  { NULL }\n")
+        for name in names:
+            row = [name] + ["%s_mip%d" % (name, level) for level in range(1, levels)]
+            f.write("  { " + ", ".join(row) + " },\n")
+        f.write("};\n\n")
+        f.write("const byte nMipmapWaveforms = %d;\n" % len(names))
+
+
+def main(argv):
+    out = os.path.join(ROOT, "waveforms", "mipmaps.cpp")
+    if len(argv) > 1 and argv[0] == "-o":
+        out = argv[1]
+        argv = argv[2:]
+
+    header = os.path.join(ROOT, "waveforms.h")
+    n_samples = read_define(header, "N_WAVEFORM_SAMPLES")
+    n_waveforms = read_define(header, "N_WAVEFORMS")
+    levels = read_define(header, "N_MIPMAP_LEVELS")
+    base_inc = read_define(header, "MIPMAP_BASE_INC")
+    rate = read_define(os.path.join(ROOT, "synthino_xm.h"), "SAMPLE_RATE")
+
+    all_names = [n for n in read_waveform_names(n_waveforms) if n is not None]
+    for name in argv:
+        if name not in all_names:
+            sys.exit("%s is not a single cycle waveform in waveformBuffers[]" % name)
+
+    bins = {}
+    for name in all_names:
+        table = read_table(name)
+        if len(table) != n_samples:
+            sys.exit("%s: %d samples, expected %d" % (name, len(table), n_samples))
+        bins[name] = spectrum(table)
+
+    tables = {}
+    for name in argv:
+        orig = read_table(name)
+        limited = [synthesize(bins[name], n_samples, n_samples,
+                              harmonic_limit(level, n_samples, base_inc))
+                   for level in range(1, levels)]
+        # Removing harmonics can raise the peaks. Scale all levels by the
+        # same amount so they fit the range of the original and the
+        # loudness does not step between levels.
+        peak = max(abs(v) for t in limited for v in t)
+        orig_peak = max(abs(v) for v in orig)
+        scale = min(1.0, orig_peak / peak) if peak > 0 else 1.0
+        tables[name] = [orig] + [[int(round(v * scale)) for v in t] for t in limited]
+
+    write_tables(out, argv, levels, tables, n_samples)
+
+    table_bytes = n_samples * 2
+    print("Wavetable mipmaps: %d waveform(s), %d levels of %d samples"
+          % (len(argv), levels, n_samples))
+    print("level  from increment  from Hz at %dHz  harmonics  bytes/waveform  bytes total"
+          % rate)
+    total = 0
+    for level in range(levels):
+        if level == 0:
+            inc, bytes_each, harmonics = 0, 0, n_samples // 2
+        else:
+            inc = base_inc << (level - 1)
+            bytes_each = table_bytes
+            harmonics = harmonic_limit(level, n_samples, base_inc)
+        total += bytes_each * len(argv)
+        print("%5d  %14.2f  %15.1f  %9d  %14d  %11d"
+              % (level, inc / 65536.0, inc / 65536.0 * rate / n_samples,
+                 harmonics, bytes_each, bytes_each * len(argv)))
+    print("flash used by mipmaps: %d bytes (%d per waveform)"
+          % (total, table_bytes * (levels - 1)))
+    print()
+    print("Energy above the harmonic limit of each level, in dB below the waveform.")
+    print("This is what playing level 0 there folds back as aliasing. * has mipmaps.")
+    print("waveform        " + "".join("%7d" % level for level in range(1, levels)))
+    for name in all_names:
+        cells = []
+        for level in range(1, levels):
+            db = energy_above(bins[name], harmonic_limit(level, n_samples, base_inc))
+            cells.append("      -" if db is None else "%7.1f" % db)
+        print("%-14s%s %s" % (name, "*" if name in argv else " ", "".join(cells)))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
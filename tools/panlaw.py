@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+#
+#  Synthino polyphonic synthesizer
+#  Copyright (C) 2014-2015 Michael Krumpus
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Render the stereo output stage to a two-channel WAV file.
+
+Usage: panlaw.py [-o panlaw.wav] [waveform]
+
+Plays one voice of a single cycle waveform (sin_0001 by default) at
+full volume while it steps from PAN_LEFT to PAN_RIGHT, a quarter of a
+second at each position, through the same integer arithmetic as the
+STEREO_OUTPUT build of renderBlock(): mixProduct() onto the 24 bit mix
+bus, panVoice() or the center bus scaled by the panGain[] table of
+synthino_xm.cpp with scaleMix(), busSample() at the headroom gain of a
+single voice, softClip() and the dithered rounding of dacSample() to
+the 12 bit DAC. The filter is left open.
+
+A table of the left and right levels at each position, and of their
+total power against the voice played in mono, goes to stdout. With a
+constant power law the total stays at 0dB and each side is -3dB at
+the center.
+"""
+
+import math
+import os
+import re
+import struct
+import sys
+import wave
+
+from wavetable import ROOT, read_define, read_table
+
+OUTPUT_RATE = 25000
+STEP_SECONDS = 0.25
+PITCH_HZ = 440.0
+
+
+def read_pan_gain():
+    with open(os.path.join(ROOT, "synthino_xm.cpp"), encoding="latin-1") as f:
+        text = f.read()
+    body = re.search(r"panGain\[[^]]*\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    return [int(v) for v in re.findall(r"\d+", body)]
+
+
+def read_soft_clip_curve():
+    with open(os.path.join(ROOT, "output.cpp"), encoding="latin-1") as f:
+        text = f.read()
+    body = re.search(r"softClipCurve\[[^]]*\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    return [int(v) for v in re.findall(r"-?\d+", body)]
+
+
+def scale_mix(v, gain):
+    """(v * gain) >> 8, as scaleVolume() and scaleMix() in output.cpp."""
+    return (v * gain) >> 8
+
+
+def bus_sample(v, gain):
+    """busSample(): the mix bus down to the 16 bit output bus."""
+    return max(-32767, min(32767, scale_mix(v, gain) >> 6))
+
+
+def soft_clip(x, curve, knee, step_bits):
+    """softClip(): straight below the knee, the curve above it."""
+    a = abs(x)
+    if a > knee:
+        i = a - knee
+        index = i >> step_bits
+        y0 = curve[index]
+        y1 = curve[index + 1]
+        a = y0 + scale_mix(y1 - y0, (i << (8 - step_bits)) & 0xFF)
+    return -a if x < 0 else a
+
+
+class Dither:
+    """ditherNoise(): TPDF dither from a 16 bit xorshift generator."""
+
+    def __init__(self):
+        self.state = 1
+
+    def noise(self):
+        x = self.state
+        x ^= (x << 7) & 0xFFFF
+        x ^= x >> 9
+        x ^= (x << 8) & 0xFFFF
+        self.state = x
+        return (x & 7) - ((x >> 8) & 7)
+
+
+def dac_sample(s, silence, fraction_bits, dither):
+    """dacSample(): round the output bus to the 12 bit DAC."""
+    s += dither.noise()
+    s = (s + (1 << (fraction_bits - 1))) >> fraction_bits
+    return max(0, min(4095, s + silence))
+
+
+def rms(values):
+    return math.sqrt(sum(v * v for v in values) / len(values))
+
+
+def db(ratio):
+    return 20.0 * math.log10(ratio) if ratio > 0 else float("-inf")
+
+
+def main(argv):
+    out_path = "panlaw.wav"
+    if len(argv) >= 2 and argv[0] == "-o":
+        out_path = argv[1]
+        argv = argv[2:]
+    name = argv[0] if argv else "sin_0001"
+
+    header = os.path.join(ROOT, "synthino_xm.h")
+    pan_left = read_define(header, "PAN_LEFT")
+    pan_center = read_define(header, "PAN_CENTER")
+    pan_right = read_define(header, "PAN_RIGHT")
+    silence = read_define(header, "SILENCE")
+    max_vol = read_define(header, "MAX_NOTE_VOL")
+    fraction_bits = read_define(header, "MIX_BUS_FRACTION_BITS")
+    output = os.path.join(ROOT, "output.cpp")
+    knee = read_define(output, "SOFT_CLIP_KNEE")
+    step_bits = read_define(output, "SOFT_CLIP_STEP_BITS")
+    curve = read_soft_clip_curve()
+    # one voice is always under the headroom setting, see setHeadroom()
+    headroom_gain = max_vol
+    dither = Dither()
+    mono_dither = Dither()
+    pan_gain = read_pan_gain()
+    if len(pan_gain) != pan_right + 1:
+        sys.exit("panGain[] has %d entries, expected %d" % (len(pan_gain), pan_right + 1))
+
+    table = read_table(name)
+    n = len(table)
+    phase_inc = int(PITCH_HZ * n / OUTPUT_RATE * 65536)
+    step = int(OUTPUT_RATE * STEP_SECONDS)
+    positions = list(range(pan_left, pan_right + 1, 8))
+
+    phase = 0
+    mono_ref = []
+    frames = bytearray()
+    print("Pan law of %s at %dHz, %d positions" % (name, OUTPUT_RATE, len(positions)))
+    print("  pan   left dB  right dB  total dB")
+    for pan in positions:
+        left_out = []
+        right_out = []
+        for s in range(step):
+            phase = (phase + phase_inc) & 0xFFFFFFFF
+            x = table[(phase >> 16) % n] * max_vol
+            if len(mono_ref) < step:
+                mono = soft_clip(bus_sample(x, headroom_gain), curve, knee, step_bits)
+                mono_ref.append(dac_sample(mono, silence, fraction_bits, mono_dither) - silence)
+            if pan == pan_center:
+                left = right = scale_mix(x, pan_gain[pan_center])
+            else:
+                left = scale_mix(x, pan_gain[pan])
+                right = scale_mix(x, pan_gain[pan_right - pan])
+            left = soft_clip(bus_sample(left, headroom_gain), curve, knee, step_bits)
+            right = soft_clip(bus_sample(right, headroom_gain), curve, knee, step_bits)
+            left = dac_sample(left, silence, fraction_bits, dither)
+            right = dac_sample(right, silence, fraction_bits, dither)
+            left_out.append(left - silence)
+            right_out.append(right - silence)
+            frames += struct.pack("<hh", (left - silence) << 4, (right - silence) << 4)
+        ref = rms(mono_ref)
+        l = rms(left_out) / ref
+        r = rms(right_out) / ref
+        print("%5d  %8.2f  %8.2f  %8.2f" % (pan, db(l), db(r), db(math.sqrt(l * l + r * r))))
+
+    with wave.open(out_path, "wb") as w:
+        w.setnchannels(2)
+        w.setsampwidth(2)
+        w.setframerate(OUTPUT_RATE)
+        w.writeframes(bytes(frames))
+    print("wrote %s, %.1f seconds" % (out_path, len(frames) / 4 / OUTPUT_RATE))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
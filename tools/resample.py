@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+#
+#  Synthino polyphonic synthesizer
+#  Copyright (C) 2014-2015 Michael Krumpus
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Resample single cycle tables to N_WAVEFORM_SAMPLES.
+
+Usage: resample.py waveform ...
+
+Rewrites waveforms/<waveform>.cpp in place with N_WAVEFORM_SAMPLES
+values. The cycle is rebuilt from its Fourier series, keeping the
+harmonics that fit in the new length, so no new aliasing is added. The
+result is clipped to the range of the original table, which keeps hard
+edged waveforms such as the square from growing Gibbs overshoot past
+their old peak. A table that already has the right length is left alone.
+"""
+
+import os
+import sys
+
+from wavetable import ROOT, read_define, read_table, write_table, spectrum, synthesize
+
+
+def main(names):
+    n_out = read_define(os.path.join(ROOT, "waveforms.h"), "N_WAVEFORM_SAMPLES")
+    for name in names:
+        table = read_table(name)
+        n_in = len(table)
+        if n_in == n_out:
+            print("%s: already %d samples" % (name, n_out))
+            continue
+        harmonics = min(n_in, n_out) // 2
+        if harmonics * 2 == n_out:
+            # the Nyquist bin of the new length has no phase to keep
+            harmonics -= 1
+        low, high = min(table), max(table)
+        out = synthesize(spectrum(table), n_in, n_out, harmonics)
+        out = [max(low, min(high, int(round(v)))) for v in out]
+        write_table(name, out)
+        print("%s: %d -> %d samples" % (name, n_in, n_out))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,78 @@
+#
+#  Synthino polyphonic synthesizer
+#  Copyright (C) 2014-2015 Michael Krumpus
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Reading, writing and Fourier resynthesis of the single cycle tables
+in waveforms/, shared by the table tools."""
+
+import cmath
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+
+def read_define(path, name):
+    with open(path, encoding="latin-1") as f:
+        m = re.search(r"^#define\s+%s\s+(\w+)" % name, f.read(), re.M)
+    if m is None:
+        sys.exit("%s: no #define %s" % (path, name))
+    return int(m.group(1).rstrip("UL"), 0)
+
+
+def table_path(name):
+    return os.path.join(ROOT, "waveforms", name + ".cpp")
+
+
+def read_table(name):
+    with open(table_path(name), encoding="latin-1") as f:
+        text = f.read()
+    body = text.split("PROGMEM = {", 1)[1].split("}", 1)[0]
+    return [int(v) for v in re.findall(r"-?\d+", body)]
+
+
+def write_table(name, table):
+    """Replace the values of table name, keeping the rest of its file."""
+    path = table_path(name)
+    with open(path, encoding="latin-1") as f:
+        text = f.read()
+    head, rest = text.split("PROGMEM = {", 1)
+    tail = rest.split("}", 1)[1]
+    body = ",\n".join("  %d" % v for v in table)
+    with open(path, "w", encoding="latin-1") as f:
+        f.write(head + "PROGMEM = {\n" + body + "\n}" + tail)
+
+
+def spectrum(table):
+    """DFT bins 0..N/2 of table."""
+    n = len(table)
+    twiddle = [cmath.exp(-2j * math.pi * m / n) for m in range(n)]
+    return [sum(x * twiddle[(k * s) % n] for s, x in enumerate(table)) for k in range(n // 2 + 1)]
+
+
+def synthesize(bins, n_in, n_out, harmonics):
+    """n_out samples of one cycle from harmonics 0..harmonics of bins,
+    the spectrum of an n_in sample table."""
+    twiddle = [cmath.exp(2j * math.pi * m / n_out) for m in range(n_out)]
+    out = []
+    for s in range(n_out):
+        v = bins[0].real / n_in
+        for k in range(1, harmonics + 1):
+            v += 2.0 * (bins[k] * twiddle[(k * s) % n_out]).real / n_in
+        out.append(v)
+    return out
@@ -33,7 +33,17 @@
 #define CLAP_WAVEFORM 17
 
 #define N_LFO_WAVEFORMS 5
-#define N_WAVEFORM_SAMPLES 600
+// Single cycle waveforms have a power of 2 length, so the phase wraps
+// by masking the table index out of it.
+#define N_WAVEFORM_SAMPLES 512
+#define WAVEFORM_INDEX_MASK (N_WAVEFORM_SAMPLES - 1)
+
+// Band-limited versions of the single cycle waveforms, one per octave of
+// phase increment starting at MIPMAP_BASE_INC (16.16). They are generated
+// by tools/mipmap.py for the waveforms listed in the Makefile, see
+// mipmapTable().
+#define N_MIPMAP_LEVELS 8
+#define MIPMAP_BASE_INC 0x10000UL
 
 // 25KHz samples
 #define KICK_LENGTH 4403
@@ -46,6 +56,8 @@
 extern const int16_t *waveformBuffers[N_TOTAL_WAVEFORMS];
 extern const int16_t *lfoWaveformBuffers[N_LFO_WAVEFORMS];
 extern const int16_t sampleLength[N_SAMPLES];
+extern const int16_t * const mipmapTables[][N_MIPMAP_LEVELS] PROGMEM;
+extern const byte nMipmapWaveforms;
 
 extern const int16_t sin_0001[N_WAVEFORM_SAMPLES] PROGMEM;
 extern const int16_t tri_0001[N_WAVEFORM_SAMPLES] PROGMEM;
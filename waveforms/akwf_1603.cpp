@@ -19,604 +19,516 @@
 #include <avr/pgmspace.h>
 #include "waveforms.h"
 const int16_t akwf_1603[N_WAVEFORM_SAMPLES] PROGMEM = {
-  257,
-  516,
-  518,
-  519,
-  521,
+  255,
+  527,
+  513,
   523,
-  524,
+  520,
   526,
-  528,
+  524,
   530,
-  531,
+  529,
   533,
-  535,
-  536,
-  538,
-  540,
+  533,
+  537,
+  537,
   542,
-  543,
+  541,
   545,
-  547,
-  548,
-  550,
-  552,
+  546,
+  549,
+  549,
+  553,
   554,
-  555,
   557,
-  559,
-  560,
+  558,
+  561,
   562,
-  564,
   565,
-  567,
+  565,
   569,
-  571,
-  572,
+  570,
+  573,
   574,
-  576,
   577,
-  579,
+  577,
   581,
-  583,
-  584,
+  582,
+  585,
   586,
-  588,
   589,
-  591,
+  589,
   593,
-  595,
-  596,
+  594,
+  597,
   598,
-  600,
   601,
-  603,
+  601,
   605,
-  607,
-  608,
+  606,
+  609,
   610,
-  612,
   613,
-  615,
+  613,
   617,
-  619,
-  620,
+  618,
+  621,
   622,
-  624,
   625,
-  627,
+  625,
+  629,
   629,
-  630,
-  632,
+  633,
   634,
-  636,
   637,
-  639,
+  637,
+  641,
   641,
-  642,
-  644,
+  645,
   646,
-  648,
   649,
-  651,
-  653,
+  650,
   654,
-  656,
+  653,
+  657,
   658,
-  660,
   661,
-  663,
-  665,
+  662,
   666,
-  668,
+  665,
+  669,
   670,
-  672,
   673,
-  675,
-  677,
+  674,
   678,
-  680,
+  677,
+  681,
   682,
-  684,
   685,
-  687,
-  689,
+  686,
   690,
-  692,
+  689,
+  693,
   694,
-  696,
   697,
-  699,
-  701,
+  698,
   702,
-  704,
+  701,
+  706,
   706,
-  707,
   709,
-  711,
-  713,
+  710,
+  714,
   714,
-  716,
   718,
-  719,
+  718,
   721,
-  723,
-  725,
+  722,
   726,
-  728,
+  726,
+  730,
   730,
-  731,
   733,
-  735,
-  737,
+  734,
+  738,
   738,
-  740,
   742,
-  743,
+  742,
   745,
-  747,
-  749,
+  746,
+  750,
   750,
-  752,
   754,
-  755,
+  754,
   757,
-  759,
-  760,
+  758,
+  761,
   762,
-  764,
   766,
-  767,
+  766,
   769,
-  771,
-  773,
+  770,
+  774,
   774,
-  776,
   778,
-  779,
+  778,
   781,
-  783,
-  784,
+  782,
+  785,
   786,
-  788,
   790,
-  791,
+  790,
   793,
-  795,
-  796,
+  794,
+  797,
   798,
-  800,
   802,
-  803,
+  802,
   805,
   807,
-  808,
+  809,
   810,
-  812,
   814,
-  815,
+  814,
   817,
   819,
-  820,
+  821,
   822,
-  824,
   826,
-  827,
+  826,
   829,
   831,
-  832,
-  834,
-  836,
+  833,
+  835,
+  838,
   838,
-  839,
   841,
   843,
-  844,
-  846,
-  848,
+  845,
+  847,
+  850,
   850,
-  851,
   853,
   855,
-  856,
-  858,
-  860,
+  857,
+  859,
   861,
-  863,
-  865,
+  862,
+  866,
   867,
-  868,
-  870,
-  872,
+  869,
+  871,
   873,
-  875,
-  877,
+  874,
+  878,
   879,
-  880,
-  882,
-  884,
+  881,
+  883,
   885,
   887,
-  889,
+  890,
   891,
-  892,
-  894,
-  896,
+  893,
+  895,
   897,
   899,
-  901,
+  902,
   903,
-  904,
-  906,
-  908,
+  905,
+  907,
   909,
   911,
   913,
   914,
-  916,
-  918,
-  920,
+  917,
+  919,
   921,
   923,
-  925,
+  926,
   927,
-  928,
-  930,
+  929,
   932,
   933,
   935,
   937,
-  938,
-  940,
-  942,
+  939,
+  941,
   944,
   945,
   947,
   949,
-  950,
-  952,
-  954,
+  951,
+  953,
   956,
   957,
   959,
   961,
-  962,
-  964,
-  966,
+  963,
+  965,
   968,
   969,
-  971,
+  972,
   973,
-  974,
-  976,
-  978,
+  975,
+  977,
   980,
   981,
-  983,
+  984,
   985,
-  986,
   988,
-  990,
-  991,
-  993,
-  995,
+  989,
+  992,
+  992,
   997,
-  998,
+  996,
+  1001,
   1000,
-  1002,
-  1003,
   1005,
-  1007,
-  1009,
+  1003,
   1010,
-  1012,
-  1014,
+  1006,
   1015,
-  1017,
-  1019,
+  1009,
   1021,
-  1022,
+  1009,
+  1024,
+  1000,
   1024,
-  256,
-  -256,
+  445,
+  -328,
+  -1024,
   -1024,
+  -1016,
   -1022,
-  -1021,
-  -1019,
-  -1017,
-  -1015,
-  -1014,
-  -1012,
-  -1010,
-  -1009,
-  -1007,
+  -1011,
+  -1018,
+  -1008,
+  -1013,
   -1005,
-  -1003,
-  -1002,
-  -1000,
-  -998,
+  -1008,
+  -1001,
+  -1004,
   -997,
-  -995,
-  -993,
-  -991,
-  -990,
-  -988,
-  -986,
+  -1000,
+  -994,
+  -996,
+  -989,
+  -992,
   -985,
+  -988,
+  -982,
   -983,
-  -981,
-  -979,
-  -978,
-  -976,
+  -977,
+  -980,
   -974,
-  -973,
+  -975,
+  -970,
   -971,
-  -969,
-  -968,
   -966,
-  -964,
+  -967,
   -962,
-  -961,
+  -963,
+  -958,
   -959,
-  -957,
-  -956,
   -954,
-  -952,
+  -955,
   -950,
-  -949,
+  -951,
+  -946,
   -947,
-  -945,
-  -944,
   -942,
-  -940,
+  -943,
   -938,
-  -937,
-  -935,
-  -933,
-  -932,
-  -930,
-  -928,
+  -939,
+  -934,
+  -934,
+  -931,
+  -931,
   -926,
-  -925,
-  -923,
-  -921,
-  -920,
-  -918,
-  -916,
+  -927,
+  -922,
+  -922,
+  -919,
+  -919,
   -914,
-  -913,
-  -911,
-  -909,
-  -908,
+  -914,
+  -910,
+  -910,
+  -907,
   -906,
-  -904,
+  -902,
   -903,
-  -901,
-  -899,
-  -897,
-  -896,
+  -898,
+  -898,
+  -895,
   -894,
-  -892,
+  -890,
   -891,
-  -889,
-  -887,
-  -885,
-  -884,
+  -886,
+  -886,
+  -883,
   -882,
-  -880,
+  -878,
   -879,
-  -877,
-  -875,
-  -873,
-  -872,
+  -874,
+  -874,
+  -871,
   -870,
-  -868,
+  -866,
   -867,
-  -865,
-  -863,
-  -861,
-  -860,
+  -862,
+  -862,
+  -859,
   -858,
-  -856,
+  -854,
   -855,
-  -853,
-  -851,
-  -849,
-  -848,
+  -850,
+  -850,
+  -846,
   -846,
-  -844,
-  -843,
-  -841,
-  -839,
-  -837,
-  -836,
+  -842,
+  -842,
+  -838,
+  -838,
+  -834,
   -834,
-  -832,
-  -831,
-  -829,
-  -827,
-  -825,
-  -824,
+  -830,
+  -830,
+  -826,
+  -826,
   -822,
-  -820,
-  -819,
-  -817,
-  -815,
+  -822,
+  -818,
+  -818,
   -814,
-  -812,
+  -815,
   -810,
-  -808,
-  -807,
-  -805,
-  -803,
+  -810,
+  -806,
+  -806,
   -802,
-  -800,
+  -803,
   -798,
-  -796,
-  -795,
-  -793,
-  -791,
+  -798,
+  -794,
+  -794,
+  -790,
   -790,
-  -788,
   -786,
-  -784,
-  -783,
-  -781,
-  -779,
+  -786,
+  -782,
+  -782,
   -778,
-  -776,
+  -778,
+  -774,
   -774,
-  -772,
-  -771,
-  -769,
-  -767,
+  -770,
+  -770,
+  -766,
   -766,
-  -764,
   -762,
-  -760,
-  -759,
-  -757,
-  -755,
+  -762,
+  -758,
+  -758,
+  -754,
   -754,
-  -752,
   -750,
-  -749,
-  -747,
-  -745,
-  -743,
+  -750,
+  -746,
+  -746,
   -742,
-  -740,
+  -742,
+  -738,
   -738,
-  -737,
-  -735,
-  -733,
-  -731,
+  -734,
+  -734,
+  -730,
   -730,
-  -728,
   -726,
-  -725,
-  -723,
-  -721,
-  -719,
+  -726,
+  -722,
+  -722,
+  -718,
   -718,
-  -716,
   -714,
-  -713,
-  -711,
-  -709,
-  -707,
+  -714,
+  -710,
+  -710,
   -706,
-  -704,
+  -706,
+  -702,
   -702,
-  -701,
-  -699,
-  -697,
-  -696,
+  -698,
+  -698,
+  -694,
   -694,
-  -692,
   -690,
-  -689,
-  -687,
-  -685,
-  -684,
+  -690,
+  -686,
+  -686,
+  -682,
   -682,
-  -680,
   -678,
-  -677,
-  -675,
-  -673,
-  -672,
+  -678,
+  -674,
+  -674,
   -670,
-  -668,
+  -670,
+  -666,
   -666,
-  -665,
-  -663,
-  -661,
-  -660,
+  -662,
+  -662,
+  -658,
   -658,
-  -656,
   -654,
-  -653,
-  -651,
-  -649,
-  -648,
+  -654,
+  -650,
+  -650,
   -646,
-  -644,
-  -642,
+  -645,
   -641,
-  -639,
+  -642,
+  -638,
   -637,
-  -636,
   -634,
-  -632,
-  -630,
+  -633,
   -629,
-  -627,
+  -630,
+  -626,
   -625,
-  -624,
   -622,
-  -620,
-  -619,
-  -617,
-  -615,
+  -621,
+  -618,
+  -618,
+  -614,
   -613,
-  -612,
   -610,
-  -608,
-  -607,
-  -605,
-  -603,
+  -609,
+  -606,
+  -606,
+  -602,
   -601,
-  -600,
   -598,
-  -596,
-  -595,
-  -593,
-  -591,
+  -597,
+  -594,
+  -594,
+  -590,
   -589,
-  -588,
   -586,
-  -584,
-  -583,
-  -581,
-  -579,
+  -585,
+  -582,
+  -582,
+  -577,
   -577,
-  -576,
   -574,
-  -572,
-  -571,
+  -573,
+  -570,
   -569,
-  -567,
   -565,
-  -564,
+  -565,
   -562,
-  -560,
-  -559,
+  -561,
+  -558,
   -557,
-  -555,
   -553,
-  -552,
+  -553,
   -550,
-  -548,
-  -547,
+  -549,
+  -546,
   -545,
-  -543,
   -541,
-  -540,
+  -541,
   -538,
-  -536,
-  -535,
+  -537,
+  -534,
   -533,
-  -531,
   -530,
-  -528,
-  -526,
-  -524,
-  -523,
+  -530,
+  -525,
+  -525,
   -521,
-  -519,
-  -518,
-  -516,
-  -257
+  -523,
+  -514,
+  -529,
+  -328
 };
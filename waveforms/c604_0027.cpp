@@ -21,602 +21,514 @@
 const int16_t c604_0027[N_WAVEFORM_SAMPLES] PROGMEM = {
   2,
   6,
-  9,
-  13,
-  16,
-  20,
-  23,
+  11,
+  14,
+  19,
+  22,
   26,
   30,
-  33,
-  37,
-  40,
-  44,
+  35,
+  38,
+  43,
   47,
   51,
   54,
-  57,
-  61,
-  64,
-  67,
-  71,
-  74,
-  78,
-  81,
-  85,
-  88,
-  92,
+  59,
+  63,
+  66,
+  70,
+  75,
+  79,
+  83,
+  87,
+  91,
   95,
-  98,
-  102,
-  105,
-  109,
-  112,
+  99,
+  103,
+  107,
+  111,
   115,
   119,
-  122,
-  126,
-  129,
-  133,
-  136,
+  123,
+  127,
+  131,
+  135,
   139,
   143,
-  146,
-  150,
-  153,
-  157,
-  160,
+  147,
+  151,
+  155,
+  159,
   163,
   167,
-  170,
-  174,
-  177,
-  180,
-  184,
+  171,
+  175,
+  179,
+  183,
   187,
   191,
-  194,
-  198,
-  201,
-  205,
-  208,
+  195,
+  199,
+  204,
+  207,
   211,
   215,
-  218,
-  222,
-  225,
-  228,
-  232,
+  219,
+  223,
+  227,
+  231,
   235,
   239,
-  242,
-  246,
-  249,
-  252,
-  256,
+  243,
+  247,
+  251,
+  255,
   259,
   263,
-  266,
-  270,
-  273,
-  276,
-  280,
+  268,
+  272,
+  275,
+  279,
   283,
   287,
-  290,
-  294,
-  297,
-  300,
-  304,
+  292,
+  296,
+  299,
+  303,
   307,
-  311,
-  314,
-  317,
-  321,
-  324,
-  328,
+  312,
+  315,
+  319,
+  323,
+  327,
   331,
-  334,
-  338,
-  341,
-  345,
+  335,
+  340,
+  343,
   348,
-  352,
-  355,
-  359,
-  362,
-  365,
-  369,
+  351,
+  356,
+  360,
+  364,
+  367,
   372,
   376,
-  379,
-  382,
-  386,
-  389,
-  393,
+  380,
+  383,
+  388,
+  391,
   396,
   400,
-  403,
-  406,
-  410,
-  413,
-  417,
+  404,
+  407,
+  412,
+  415,
   420,
   424,
-  427,
-  430,
-  434,
-  437,
-  441,
+  428,
+  431,
+  436,
+  440,
   444,
   447,
-  451,
-  454,
-  458,
-  461,
-  465,
+  452,
+  455,
+  460,
+  464,
   468,
   472,
-  475,
-  478,
-  482,
-  485,
-  489,
+  476,
+  479,
+  484,
+  488,
   492,
   496,
-  499,
-  502,
-  506,
-  509,
-  513,
-  516,
+  500,
+  503,
+  508,
+  512,
+  517,
   520,
-  523,
-  526,
-  530,
+  524,
+  528,
   533,
-  537,
-  540,
+  536,
+  541,
   543,
-  547,
-  550,
-  554,
+  549,
+  552,
   557,
-  561,
-  564,
+  560,
+  565,
   567,
-  571,
-  574,
-  578,
+  573,
+  576,
   581,
-  585,
-  588,
+  584,
+  589,
   591,
-  595,
-  598,
-  602,
+  597,
+  600,
   605,
-  608,
-  612,
-  615,
-  619,
-  622,
-  626,
+  607,
+  613,
+  616,
+  621,
+  624,
   629,
-  633,
-  636,
-  639,
-  643,
-  646,
-  650,
+  632,
+  637,
+  640,
+  645,
+  648,
   653,
-  656,
-  660,
-  663,
-  667,
-  670,
-  674,
-  677,
-  680,
-  684,
-  687,
-  691,
+  655,
+  661,
+  664,
+  669,
+  672,
+  678,
+  679,
+  686,
+  688,
   694,
-  697,
+  695,
   701,
   704,
-  708,
-  711,
-  715,
+  710,
+  712,
   718,
-  721,
-  725,
+  719,
+  726,
   728,
-  732,
-  735,
-  739,
+  734,
+  736,
   742,
-  745,
-  749,
+  743,
+  750,
   752,
-  756,
+  758,
   759,
-  762,
   766,
-  769,
-  773,
+  768,
+  774,
   776,
-  780,
-  783,
-  787,
+  782,
+  784,
   790,
-  793,
-  797,
+  791,
+  798,
   800,
-  804,
-  807,
-  811,
-  814,
-  817,
-  821,
+  806,
+  808,
+  815,
+  815,
+  823,
   824,
-  828,
   831,
-  834,
+  831,
   838,
-  841,
-  845,
+  839,
+  847,
   848,
-  852,
   855,
-  858,
-  862,
-  865,
-  869,
-  872,
-  876,
+  855,
+  863,
+  863,
+  871,
+  871,
+  879,
   879,
-  882,
-  886,
-  889,
-  893,
-  896,
-  900,
+  887,
+  887,
+  895,
+  895,
+  904,
   903,
-  906,
-  910,
-  913,
-  917,
+  912,
+  911,
   920,
-  923,
-  927,
-  930,
+  918,
+  928,
+  926,
+  936,
   934,
-  937,
-  941,
-  944,
-  947,
-  951,
-  954,
-  958,
+  945,
+  942,
+  953,
+  950,
   961,
+  958,
+  970,
   965,
-  968,
+  979,
   972,
-  975,
-  978,
-  982,
-  985,
   988,
-  992,
-  995,
-  999,
-  1002,
-  1006,
-  1009,
-  1013,
-  1016,
+  979,
+  996,
+  985,
+  1007,
+  991,
   1019,
+  993,
+  1023,
+  981,
   1023,
-  0,
+  233,
+  -1019,
+  -1005,
   -1024,
-  -1020,
+  -1001,
   -1017,
-  -1014,
-  -1010,
+  -995,
   -1007,
-  -1003,
-  -1000,
-  -997,
-  -993,
   -990,
-  -986,
+  -998,
   -983,
-  -979,
-  -976,
-  -973,
-  -969,
-  -966,
-  -962,
-  -959,
-  -955,
+  -989,
+  -975,
+  -980,
+  -968,
+  -971,
+  -960,
+  -963,
   -952,
-  -949,
+  -955,
   -945,
-  -942,
+  -946,
+  -937,
   -938,
-  -935,
-  -932,
-  -928,
-  -925,
+  -930,
+  -930,
+  -922,
   -921,
-  -918,
   -914,
-  -911,
-  -907,
-  -904,
-  -901,
+  -913,
+  -905,
+  -905,
+  -898,
   -897,
-  -894,
   -890,
-  -887,
-  -884,
-  -880,
-  -877,
+  -889,
+  -883,
+  -881,
+  -874,
   -873,
-  -870,
   -866,
-  -863,
-  -860,
+  -864,
+  -859,
   -856,
-  -853,
-  -849,
-  -846,
+  -850,
+  -848,
   -842,
-  -839,
-  -836,
+  -840,
+  -835,
   -832,
-  -829,
-  -825,
-  -822,
+  -827,
+  -824,
   -819,
-  -815,
-  -812,
+  -816,
+  -811,
   -808,
-  -805,
-  -801,
-  -798,
+  -803,
+  -800,
   -795,
-  -791,
-  -788,
+  -792,
+  -787,
   -784,
-  -781,
-  -777,
-  -774,
+  -778,
+  -775,
   -771,
-  -767,
-  -764,
+  -768,
+  -763,
   -760,
-  -757,
-  -753,
-  -750,
+  -754,
+  -751,
   -747,
   -743,
-  -740,
-  -736,
-  -733,
-  -730,
-  -726,
+  -739,
+  -735,
+  -731,
+  -728,
   -723,
   -719,
-  -716,
-  -712,
-  -709,
-  -706,
-  -702,
+  -715,
+  -711,
+  -707,
+  -703,
   -699,
   -695,
-  -692,
-  -688,
-  -685,
-  -681,
-  -678,
+  -690,
+  -687,
+  -682,
+  -679,
   -675,
   -671,
-  -668,
-  -664,
-  -661,
-  -658,
-  -654,
+  -667,
+  -663,
+  -659,
+  -655,
   -651,
   -647,
-  -644,
-  -640,
-  -637,
-  -634,
-  -630,
+  -643,
+  -639,
+  -635,
+  -631,
   -627,
-  -623,
-  -620,
-  -617,
-  -613,
-  -610,
-  -606,
+  -622,
+  -619,
+  -615,
+  -611,
+  -607,
   -603,
-  -599,
-  -596,
-  -593,
-  -589,
-  -586,
-  -582,
-  -579,
-  -575,
-  -572,
-  -569,
-  -565,
-  -562,
+  -598,
+  -595,
+  -591,
+  -587,
+  -583,
+  -578,
+  -574,
+  -571,
+  -567,
+  -563,
   -558,
-  -555,
-  -551,
-  -548,
-  -545,
-  -541,
+  -554,
+  -550,
+  -547,
+  -543,
   -538,
   -534,
-  -531,
-  -527,
-  -524,
-  -521,
-  -517,
+  -530,
+  -526,
+  -523,
+  -518,
   -514,
   -510,
   -507,
-  -504,
-  -500,
-  -497,
-  -493,
+  -503,
+  -498,
+  -494,
   -490,
   -486,
-  -483,
-  -479,
-  -476,
-  -473,
-  -469,
+  -482,
+  -478,
+  -474,
+  -470,
   -466,
   -462,
-  -459,
-  -456,
-  -452,
-  -449,
-  -445,
+  -458,
+  -454,
+  -450,
+  -446,
   -442,
   -438,
-  -435,
-  -432,
-  -428,
-  -425,
-  -421,
+  -434,
+  -430,
+  -426,
+  -422,
   -418,
-  -415,
-  -411,
-  -408,
-  -404,
-  -401,
-  -397,
+  -414,
+  -410,
+  -406,
+  -402,
+  -398,
   -394,
-  -391,
-  -387,
-  -384,
-  -380,
-  -377,
-  -373,
+  -390,
+  -386,
+  -382,
+  -378,
+  -374,
   -370,
-  -367,
-  -363,
-  -360,
-  -356,
-  -353,
-  -349,
+  -366,
+  -362,
+  -358,
+  -354,
+  -350,
   -346,
-  -343,
-  -339,
-  -336,
-  -332,
-  -329,
+  -342,
+  -338,
+  -334,
+  -330,
   -325,
   -322,
-  -319,
-  -315,
-  -312,
-  -308,
-  -305,
+  -318,
+  -314,
+  -310,
+  -306,
   -302,
   -298,
-  -295,
-  -291,
-  -288,
-  -284,
-  -281,
+  -294,
+  -290,
+  -286,
+  -282,
   -278,
   -274,
-  -271,
-  -267,
-  -264,
-  -260,
+  -270,
+  -266,
+  -261,
   -257,
   -254,
   -250,
-  -247,
-  -243,
-  -240,
-  -236,
+  -246,
+  -241,
+  -237,
   -233,
   -230,
-  -226,
-  -223,
-  -219,
-  -216,
-  -212,
+  -225,
+  -221,
+  -217,
+  -213,
   -209,
   -206,
-  -202,
-  -199,
-  -195,
-  -192,
-  -189,
+  -201,
+  -197,
+  -193,
+  -190,
   -185,
-  -182,
-  -178,
-  -175,
-  -171,
-  -168,
-  -165,
+  -181,
+  -177,
+  -173,
+  -169,
+  -166,
   -161,
-  -158,
-  -154,
-  -151,
-  -147,
-  -144,
-  -141,
+  -157,
+  -153,
+  -149,
+  -145,
+  -142,
   -137,
-  -134,
-  -130,
-  -127,
-  -123,
-  -120,
+  -133,
+  -129,
+  -125,
+  -121,
   -117,
   -113,
-  -110,
-  -106,
-  -103,
-  -99,
-  -96,
+  -109,
+  -105,
+  -101,
+  -97,
   -93,
   -89,
-  -86,
-  -82,
-  -79,
-  -76,
-  -72,
+  -85,
+  -81,
+  -77,
+  -73,
   -69,
   -65,
-  -62,
-  -58,
-  -55,
-  -52,
-  -48,
+  -61,
+  -57,
+  -53,
+  -49,
   -45,
   -41,
-  -38,
-  -35,
-  -31,
-  -28,
-  -24,
+  -37,
+  -33,
+  -29,
+  -25,
   -21,
   -17,
-  -14,
-  -10,
-  -7,
-  -4,
-  0
+  -13,
+  -9,
+  -5,
+  -1
 };
@@ -20,603 +20,515 @@
 #include "waveforms.h"
 const int16_t cello_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   0,
-  3,
-  16,
-  41,
-  60,
-  73,
-  85,
+  4,
+  24,
+  52,
+  69,
+  84,
   97,
-  111,
-  130,
-  154,
-  179,
-  198,
-  213,
+  115,
+  138,
+  168,
+  193,
+  212,
   226,
+  235,
   234,
-  236,
-  231,
-  228,
+  229,
   227,
-  223,
-  217,
-  209,
-  204,
-  197,
-  185,
-  172,
-  159,
-  147,
-  134,
-  121,
-  109,
-  101,
-  96,
-  96,
-  103,
-  117,
-  138,
-  167,
+  224,
+  216,
+  207,
   202,
-  243,
-  287,
-  332,
-  373,
-  407,
-  436,
-  465,
-  495,
-  524,
-  549,
-  568,
-  580,
-  586,
-  589,
+  190,
+  175,
+  160,
+  145,
+  130,
+  115,
+  103,
+  97,
+  96,
+  105,
+  123,
+  152,
+  190,
+  236,
+  288,
+  340,
+  386,
+  423,
+  456,
+  491,
+  525,
+  554,
+  574,
+  584,
+  588,
   589,
   587,
   586,
-  590,
-  602,
-  621,
-  645,
-  670,
-  696,
-  725,
-  762,
-  805,
-  851,
-  893,
-  933,
-  969,
-  999,
-  1019,
-  1024,
-  1018,
-  1004,
-  987,
-  966,
-  943,
-  921,
-  905,
-  892,
-  879,
-  864,
-  844,
-  822,
-  797,
-  770,
-  743,
-  719,
-  699,
-  683,
+  594,
+  613,
+  639,
   669,
-  657,
-  643,
-  627,
-  610,
-  590,
-  569,
-  546,
-  523,
-  501,
-  478,
-  455,
-  434,
-  414,
-  397,
-  378,
-  355,
-  328,
+  699,
+  735,
+  781,
+  834,
+  885,
+  932,
+  974,
+  1007,
+  1023,
+  1021,
+  1007,
+  987,
+  962,
+  935,
+  912,
+  896,
+  881,
+  863,
+  840,
+  813,
+  782,
+  750,
+  721,
+  698,
+  679,
+  664,
+  649,
+  631,
+  611,
+  588,
+  563,
+  536,
+  510,
+  483,
+  456,
+  431,
+  409,
+  389,
+  364,
+  333,
   300,
-  269,
-  237,
-  201,
-  164,
-  127,
-  91,
-  54,
-  16,
-  -24,
-  -65,
-  -105,
-  -145,
-  -181,
-  -211,
-  -235,
-  -257,
-  -274,
-  -284,
-  -289,
-  -297,
-  -314,
-  -334,
-  -357,
-  -383,
-  -417,
-  -458,
-  -498,
-  -538,
-  -579,
-  -625,
-  -674,
-  -723,
-  -769,
-  -810,
-  -842,
-  -869,
-  -892,
-  -909,
-  -918,
+  264,
+  225,
+  183,
+  139,
+  97,
+  53,
+  9,
+  -39,
+  -86,
+  -133,
+  -177,
+  -212,
+  -240,
+  -264,
+  -281,
+  -288,
+  -296,
+  -315,
+  -340,
+  -367,
+  -402,
+  -448,
+  -496,
+  -542,
+  -592,
+  -647,
+  -705,
+  -760,
+  -809,
+  -846,
+  -877,
+  -901,
+  -916,
   -919,
   -914,
-  -902,
-  -885,
-  -865,
-  -847,
-  -835,
-  -828,
+  -899,
+  -878,
+  -855,
+  -838,
+  -829,
   -823,
-  -818,
-  -811,
-  -802,
-  -791,
-  -778,
-  -766,
-  -761,
-  -763,
-  -771,
-  -782,
-  -794,
-  -807,
   -817,
-  -825,
-  -832,
-  -837,
+  -808,
+  -796,
+  -782,
+  -767,
+  -761,
+  -764,
+  -775,
+  -789,
+  -804,
+  -816,
+  -826,
+  -834,
   -838,
-  -833,
-  -822,
-  -806,
-  -781,
-  -748,
-  -710,
-  -676,
-  -647,
-  -619,
-  -590,
-  -561,
-  -534,
-  -514,
-  -506,
-  -514,
-  -534,
+  -836,
+  -825,
+  -807,
+  -777,
+  -737,
+  -693,
+  -657,
+  -624,
+  -591,
+  -556,
+  -526,
+  -508,
+  -510,
+  -531,
   -554,
-  -573,
-  -590,
-  -608,
-  -627,
-  -644,
-  -658,
-  -664,
-  -664,
-  -661,
+  -576,
+  -596,
+  -618,
+  -639,
   -656,
-  -646,
-  -630,
-  -608,
-  -587,
-  -567,
-  -548,
-  -531,
-  -517,
-  -506,
-  -493,
-  -477,
-  -461,
-  -445,
-  -430,
-  -417,
-  -405,
+  -664,
+  -663,
+  -660,
+  -651,
+  -635,
+  -610,
+  -585,
+  -562,
+  -541,
+  -522,
+  -509,
+  -494,
+  -475,
+  -456,
+  -438,
+  -422,
+  -407,
   -393,
-  -379,
-  -365,
-  -349,
-  -332,
-  -316,
-  -301,
+  -377,
+  -360,
+  -341,
+  -321,
+  -304,
   -282,
-  -259,
-  -237,
-  -218,
-  -204,
-  -187,
-  -162,
-  -127,
-  -87,
-  -45,
-  -5,
-  31,
-  59,
-  78,
-  91,
-  102,
-  112,
-  126,
-  143,
-  165,
-  187,
-  204,
-  216,
-  224,
-  230,
-  238,
-  249,
-  263,
-  273,
-  277,
+  -255,
+  -230,
+  -211,
+  -193,
+  -166,
+  -126,
+  -78,
+  -30,
+  15,
+  52,
+  76,
+  92,
+  104,
+  117,
+  135,
+  159,
+  186,
+  205,
+  219,
+  227,
+  235,
+  246,
+  262,
+  274,
   278,
-  275,
-  267,
-  254,
+  277,
+  270,
+  257,
   239,
-  228,
-  220,
-  213,
-  205,
-  195,
-  185,
+  227,
+  218,
+  209,
+  198,
+  187,
   172,
-  159,
-  148,
-  143,
+  157,
+  145,
   143,
-  140,
+  141,
   136,
   128,
-  116,
-  99,
-  76,
-  48,
-  18,
-  -12,
-  -42,
-  -69,
-  -92,
-  -113,
-  -131,
-  -146,
+  113,
+  91,
+  61,
+  26,
+  -9,
+  -44,
+  -75,
+  -101,
+  -124,
+  -143,
   -157,
-  -166,
-  -172,
+  -167,
+  -173,
   -175,
-  -172,
-  -162,
-  -150,
-  -138,
-  -127,
-  -119,
-  -119,
-  -126,
-  -138,
-  -146,
+  -166,
+  -152,
+  -139,
+  -125,
+  -118,
+  -121,
+  -134,
+  -145,
   -149,
   -151,
-  -156,
-  -164,
-  -167,
-  -169,
+  -159,
+  -166,
+  -168,
   -172,
   -177,
   -179,
-  -174,
-  -167,
-  -158,
-  -141,
-  -114,
-  -83,
-  -55,
-  -28,
-  1,
-  33,
-  68,
-  103,
-  136,
-  162,
-  176,
-  190,
-  206,
-  223,
+  -171,
+  -163,
+  -147,
+  -117,
+  -81,
+  -49,
+  -16,
+  19,
+  59,
+  100,
+  139,
+  166,
+  182,
+  199,
+  220,
   228,
-  215,
-  201,
-  192,
+  214,
   197,
   194,
-  184,
+  197,
+  186,
   173,
-  178,
-  199,
-  221,
-  232,
-  229,
+  180,
+  207,
+  228,
   231,
-  239,
-  255,
+  230,
+  240,
+  257,
   261,
-  258,
   257,
-  262,
-  277,
-  303,
-  330,
-  347,
-  344,
-  340,
-  360,
+  260,
+  274,
+  305,
+  335,
+  348,
+  339,
+  353,
   376,
-  379,
-  364,
-  356,
-  365,
-  372,
-  381,
+  378,
+  360,
+  359,
+  370,
+  378,
   391,
-  394,
-  392,
-  395,
-  401,
+  393,
+  393,
+  397,
   406,
   401,
-  417,
-  459,
-  493,
-  517,
-  533,
-  561,
-  584,
+  416,
+  464,
+  502,
+  524,
+  550,
+  582,
   583,
-  571,
-  564,
-  574,
-  600,
-  629,
+  569,
+  565,
+  586,
+  621,
   640,
-  634,
-  620,
-  624,
-  639,
+  633,
+  619,
+  629,
   644,
-  635,
-  615,
-  593,
-  578,
-  570,
-  555,
-  526,
-  489,
+  638,
+  618,
+  591,
+  576,
+  565,
+  541,
+  497,
   479,
   481,
-  474,
-  444,
-  397,
-  358,
-  326,
+  469,
+  424,
+  372,
+  333,
   308,
-  310,
-  315,
-  306,
-  282,
-  254,
-  233,
-  194,
-  137,
-  72,
-  15,
-  -27,
-  -63,
-  -95,
+  311,
+  314,
+  296,
+  263,
+  237,
+  195,
+  127,
+  52,
+  -8,
+  -51,
+  -90,
   -128,
-  -159,
-  -181,
-  -187,
-  -187,
-  -181,
-  -168,
-  -139,
-  -99,
-  -65,
-  -33,
-  -1,
-  29,
-  51,
+  -165,
+  -184,
+  -188,
+  -183,
+  -170,
+  -137,
+  -91,
+  -53,
+  -15,
+  21,
+  49,
   60,
-  64,
-  66,
+  65,
   67,
-  64,
-  54,
-  36,
-  11,
-  -12,
-  -23,
-  -22,
-  -15,
-  -9,
+  66,
+  57,
+  37,
+  8,
+  -16,
+  -24,
+  -18,
+  -10,
   -3,
-  13,
-  45,
-  87,
-  129,
-  163,
-  189,
+  17,
+  58,
+  108,
+  153,
+  185,
   222,
-  265,
-  313,
-  349,
-  368,
-  377,
-  373,
-  358,
-  326,
-  281,
-  226,
-  165,
-  103,
-  46,
-  -7,
-  -60,
-  -113,
-  -160,
-  -198,
-  -233,
-  -264,
-  -289,
-  -306,
-  -317,
-  -324,
-  -332,
-  -347,
-  -373,
-  -404,
-  -437,
-  -473,
-  -514,
-  -559,
-  -598,
-  -633,
-  -669,
-  -705,
-  -739,
-  -767,
-  -789,
-  -800,
+  273,
+  327,
+  360,
+  375,
+  375,
+  357,
+  318,
+  261,
+  193,
+  120,
+  52,
+  -10,
+  -73,
+  -133,
+  -183,
+  -224,
+  -262,
+  -291,
+  -310,
+  -320,
+  -328,
+  -343,
+  -372,
+  -408,
+  -447,
+  -491,
+  -543,
+  -591,
+  -632,
+  -675,
+  -717,
+  -754,
+  -783,
   -799,
-  -790,
-  -776,
-  -752,
-  -720,
-  -689,
-  -668,
-  -651,
-  -622,
-  -586,
-  -547,
-  -511,
-  -480,
-  -451,
-  -427,
-  -409,
-  -395,
-  -386,
-  -378,
-  -369,
-  -357,
-  -342,
-  -325,
-  -308,
-  -292,
-  -279,
-  -264,
-  -244,
-  -220,
-  -197,
-  -178,
-  -153,
-  -120,
-  -85,
+  -799,
+  -788,
+  -769,
+  -736,
+  -697,
+  -670,
+  -650,
+  -615,
+  -571,
+  -526,
+  -488,
+  -454,
+  -425,
+  -405,
+  -391,
+  -381,
+  -371,
+  -358,
+  -340,
+  -320,
+  -300,
+  -284,
+  -267,
+  -245,
+  -216,
+  -191,
+  -167,
+  -132,
+  -91,
   -56,
-  -36,
-  -20,
-  -6,
-  6,
+  -33,
+  -15,
+  1,
   11,
-  6,
+  7,
   -10,
-  -30,
-  -47,
-  -58,
-  -68,
-  -76,
+  -34,
+  -51,
+  -64,
+  -74,
   -79,
   -78,
-  -73,
-  -67,
-  -59,
-  -48,
-  -28,
-  1,
-  40,
-  81,
-  117,
-  150,
-  174,
-  188,
+  -72,
+  -64,
+  -53,
+  -34,
+  -2,
+  44,
+  91,
+  132,
+  166,
+  186,
   189,
-  180,
-  169,
-  149,
-  125,
-  104,
-  88,
+  179,
+  164,
+  138,
+  111,
+  90,
   78,
-  63,
-  47,
-  31,
-  14,
-  -2,
-  -17,
+  61,
+  42,
+  23,
+  3,
+  -15,
   -26,
   -27,
-  -25,
-  -21,
-  -16,
-  -15,
+  -24,
   -18,
+  -15,
+  -17,
   -21,
-  -25,
-  -32,
-  -45,
-  -56,
-  -64,
-  -72,
-  -85,
-  -102,
-  -116,
-  -124,
+  -26,
+  -37,
+  -52,
+  -62,
+  -71,
+  -86,
+  -106,
+  -120,
   -126,
   -125,
   -121,
-  -115,
-  -108,
-  -99,
-  -89,
-  -77,
-  -65,
+  -114,
+  -106,
+  -95,
+  -82,
+  -67,
   -53,
-  -42,
-  -31,
-  -21,
-  -12,
-  -5,
+  -40,
+  -28,
+  -17,
+  -7,
   -3
 };
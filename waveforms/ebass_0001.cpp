@@ -20,603 +20,515 @@
 #include "waveforms.h"
 const int16_t ebass_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   3,
-  23,
-  43,
-  64,
-  84,
-  104,
-  125,
-  145,
-  165,
-  185,
-  205,
-  225,
-  245,
-  264,
-  283,
-  302,
-  321,
-  339,
-  357,
-  375,
-  393,
-  411,
-  428,
-  446,
-  463,
-  480,
-  497,
-  514,
-  531,
-  547,
-  564,
-  580,
-  596,
-  613,
+  26,
+  50,
+  75,
+  98,
+  122,
+  146,
+  169,
+  192,
+  216,
+  239,
+  262,
+  284,
+  307,
+  328,
+  349,
+  370,
+  392,
+  413,
+  433,
+  454,
+  473,
+  493,
+  513,
+  533,
+  552,
+  572,
+  590,
+  610,
   629,
-  644,
-  660,
-  675,
-  690,
-  705,
-  719,
+  647,
+  665,
+  682,
+  700,
+  717,
   733,
-  746,
-  760,
-  772,
-  785,
-  797,
-  808,
-  819,
-  830,
-  840,
-  850,
-  860,
-  869,
-  879,
-  887,
-  896,
-  905,
-  913,
-  921,
-  929,
-  937,
-  945,
-  953,
-  960,
-  968,
-  975,
-  981,
+  749,
+  764,
+  779,
+  794,
+  807,
+  820,
+  832,
+  844,
+  856,
+  867,
+  878,
+  888,
+  898,
+  909,
+  918,
+  927,
+  936,
+  946,
+  955,
+  964,
+  973,
+  980,
   988,
-  993,
-  999,
-  1004,
-  1008,
-  1012,
-  1016,
+  994,
+  1001,
+  1006,
+  1011,
+  1015,
   1018,
   1021,
   1022,
-  1023,
   1024,
   1024,
   1024,
   1023,
   1022,
-  1020,
-  1018,
-  1016,
-  1014,
+  1019,
+  1017,
+  1015,
   1012,
   1009,
-  1007,
-  1004,
-  1002,
-  999,
-  996,
+  1006,
+  1003,
+  1000,
+  997,
   994,
   991,
-  988,
-  985,
-  981,
-  978,
-  974,
+  987,
+  983,
+  979,
+  975,
   969,
-  965,
-  960,
-  954,
-  948,
-  942,
-  935,
+  964,
+  958,
+  951,
+  944,
+  936,
   928,
-  920,
-  912,
-  904,
-  895,
-  886,
-  877,
+  919,
+  909,
+  900,
+  889,
+  878,
   867,
-  858,
-  848,
-  837,
-  827,
-  817,
-  806,
+  856,
+  844,
+  832,
+  820,
+  807,
   795,
-  785,
-  774,
-  763,
-  752,
-  741,
-  729,
-  718,
-  706,
-  694,
-  682,
-  669,
-  657,
-  644,
-  630,
-  617,
-  603,
-  590,
-  576,
-  562,
-  548,
-  534,
-  520,
-  506,
-  492,
-  478,
-  464,
+  783,
+  770,
+  757,
+  744,
+  730,
+  717,
+  703,
+  689,
+  674,
+  660,
+  645,
+  629,
+  613,
+  597,
+  581,
+  565,
+  549,
+  532,
+  516,
+  499,
+  483,
+  466,
   450,
-  437,
-  423,
-  410,
-  397,
-  384,
-  371,
+  434,
+  419,
+  403,
+  388,
+  373,
   358,
-  345,
-  332,
-  320,
-  307,
-  294,
-  281,
-  267,
-  254,
-  240,
-  226,
-  212,
-  197,
-  182,
-  167,
-  152,
-  137,
-  122,
-  107,
-  91,
-  76,
-  61,
-  46,
-  31,
-  17,
-  2,
-  -12,
+  342,
+  328,
+  313,
+  298,
+  282,
+  266,
+  251,
+  234,
+  218,
+  201,
+  183,
+  166,
+  148,
+  130,
+  113,
+  95,
+  77,
+  59,
+  41,
+  24,
+  7,
+  -10,
   -26,
-  -39,
-  -53,
-  -65,
-  -78,
-  -90,
-  -102,
+  -41,
+  -57,
+  -71,
+  -86,
+  -100,
   -113,
-  -124,
-  -134,
-  -144,
-  -154,
-  -164,
-  -172,
+  -126,
+  -138,
+  -149,
+  -161,
+  -171,
   -181,
-  -189,
-  -197,
-  -205,
-  -212,
-  -219,
-  -226,
-  -232,
-  -239,
-  -245,
-  -250,
-  -255,
-  -260,
+  -191,
+  -200,
+  -209,
+  -217,
+  -225,
+  -233,
+  -241,
+  -247,
+  -253,
+  -259,
   -265,
   -270,
-  -274,
-  -278,
-  -282,
-  -286,
+  -275,
+  -280,
+  -284,
   -289,
   -292,
-  -295,
-  -298,
-  -300,
-  -303,
-  -305,
+  -296,
+  -299,
+  -301,
+  -304,
   -307,
   -309,
   -310,
   -312,
   -313,
-  -314,
   -315,
   -315,
   -316,
   -316,
   -316,
   -315,
-  -315,
   -314,
   -312,
   -311,
   -308,
-  -306,
-  -303,
-  -300,
-  -296,
+  -305,
+  -301,
+  -297,
   -292,
   -288,
-  -284,
-  -279,
-  -273,
-  -268,
-  -262,
+  -283,
+  -276,
+  -270,
+  -263,
   -257,
-  -251,
-  -245,
-  -239,
-  -233,
-  -227,
-  -221,
+  -250,
+  -243,
+  -236,
+  -229,
+  -222,
   -215,
-  -210,
-  -205,
-  -201,
-  -197,
-  -193,
+  -209,
+  -204,
+  -199,
+  -194,
   -190,
   -188,
   -186,
   -185,
   -185,
-  -185,
   -186,
   -187,
   -190,
-  -193,
-  -197,
-  -201,
-  -206,
-  -212,
-  -219,
-  -226,
-  -233,
-  -241,
-  -250,
-  -259,
-  -269,
-  -279,
-  -289,
-  -300,
-  -311,
-  -322,
-  -334,
-  -345,
+  -194,
+  -198,
+  -204,
+  -210,
+  -218,
+  -227,
+  -235,
+  -245,
+  -255,
+  -267,
+  -278,
+  -290,
+  -303,
+  -316,
+  -330,
+  -343,
   -357,
-  -370,
-  -382,
-  -395,
-  -408,
-  -421,
-  -434,
+  -372,
+  -386,
+  -401,
+  -416,
+  -432,
   -448,
-  -462,
-  -476,
-  -490,
-  -505,
-  -519,
-  -534,
-  -549,
-  -564,
-  -579,
-  -595,
-  -610,
-  -626,
-  -641,
-  -657,
-  -672,
-  -688,
-  -703,
-  -719,
-  -734,
-  -749,
-  -764,
-  -778,
-  -792,
-  -806,
-  -819,
-  -832,
-  -844,
-  -856,
-  -867,
-  -877,
-  -886,
-  -895,
-  -903,
+  -464,
+  -481,
+  -498,
+  -515,
+  -532,
+  -550,
+  -567,
+  -585,
+  -603,
+  -621,
+  -640,
+  -658,
+  -676,
+  -694,
+  -712,
+  -730,
+  -748,
+  -765,
+  -782,
+  -798,
+  -814,
+  -829,
+  -843,
+  -857,
+  -870,
+  -881,
+  -892,
+  -902,
   -909,
-  -915,
-  -920,
-  -924,
-  -927,
-  -929,
+  -916,
+  -921,
+  -926,
+  -928,
   -930,
   -929,
   -928,
-  -925,
-  -920,
-  -915,
-  -908,
-  -900,
+  -923,
+  -917,
+  -910,
+  -901,
   -891,
-  -881,
-  -869,
-  -856,
-  -842,
-  -827,
-  -810,
-  -792,
-  -773,
-  -753,
-  -732,
-  -710,
-  -687,
-  -663,
-  -638,
-  -612,
-  -586,
-  -558,
-  -530,
-  -501,
-  -472,
-  -442,
-  -412,
-  -381,
-  -349,
-  -318,
-  -286,
+  -878,
+  -864,
+  -848,
+  -831,
+  -812,
+  -790,
+  -768,
+  -744,
+  -719,
+  -692,
+  -665,
+  -635,
+  -605,
+  -573,
+  -541,
+  -507,
+  -473,
+  -438,
+  -402,
+  -365,
+  -329,
+  -292,
   -253,
-  -221,
-  -188,
-  -156,
-  -123,
-  -90,
-  -57,
-  -25,
-  8,
-  40,
-  72,
-  104,
-  136,
-  167,
-  198,
-  228,
-  258,
-  287,
-  315,
-  343,
-  370,
-  397,
-  422,
-  447,
-  471,
-  495,
-  517,
-  538,
-  559,
-  579,
-  597,
-  615,
-  632,
-  648,
+  -215,
+  -177,
+  -139,
+  -100,
+  -62,
+  -24,
+  14,
+  52,
+  89,
+  127,
+  164,
+  200,
+  235,
+  270,
+  303,
+  336,
+  368,
+  399,
+  429,
+  458,
+  486,
+  512,
+  537,
+  562,
+  584,
+  606,
+  626,
+  645,
   662,
-  676,
-  689,
-  701,
-  712,
-  722,
-  730,
+  678,
+  693,
+  707,
+  719,
+  729,
   738,
-  745,
-  751,
-  755,
-  759,
-  762,
+  746,
+  753,
+  757,
+  761,
   763,
   764,
   763,
-  762,
-  759,
-  756,
-  752,
-  746,
-  740,
-  733,
-  725,
-  716,
-  706,
-  695,
-  684,
-  671,
-  658,
-  645,
-  630,
-  615,
-  599,
+  761,
+  757,
+  753,
+  747,
+  739,
+  731,
+  721,
+  710,
+  698,
+  685,
+  670,
+  654,
+  638,
+  621,
+  602,
   583,
-  565,
-  547,
-  529,
-  510,
-  490,
-  470,
+  563,
+  541,
+  520,
+  497,
+  474,
   450,
-  428,
-  407,
-  385,
-  363,
-  340,
-  317,
-  294,
-  271,
-  247,
-  223,
-  199,
-  175,
-  150,
-  126,
-  101,
-  76,
-  51,
-  26,
-  2,
-  -23,
-  -48,
-  -73,
-  -97,
-  -122,
-  -146,
-  -170,
-  -194,
-  -218,
-  -242,
-  -265,
-  -288,
-  -311,
-  -333,
+  424,
+  399,
+  374,
+  347,
+  320,
+  293,
+  266,
+  238,
+  210,
+  182,
+  153,
+  124,
+  95,
+  66,
+  36,
+  8,
+  -21,
+  -51,
+  -79,
+  -108,
+  -137,
+  -165,
+  -193,
+  -221,
+  -249,
+  -276,
+  -303,
+  -329,
   -355,
-  -377,
-  -399,
-  -420,
-  -441,
-  -461,
-  -482,
-  -501,
-  -521,
-  -540,
-  -559,
-  -577,
-  -595,
-  -613,
-  -630,
-  -647,
-  -663,
-  -679,
-  -694,
-  -709,
-  -723,
-  -737,
-  -751,
-  -764,
-  -776,
-  -788,
-  -799,
-  -810,
-  -820,
-  -830,
-  -839,
-  -847,
-  -855,
-  -862,
+  -381,
+  -406,
+  -431,
+  -454,
+  -479,
+  -502,
+  -524,
+  -547,
+  -569,
+  -590,
+  -611,
+  -631,
+  -650,
+  -669,
+  -688,
+  -705,
+  -722,
+  -738,
+  -754,
+  -769,
+  -783,
+  -796,
+  -809,
+  -821,
+  -833,
+  -843,
+  -852,
+  -861,
   -869,
-  -876,
-  -881,
-  -887,
-  -891,
-  -895,
-  -899,
+  -877,
+  -883,
+  -889,
+  -893,
+  -898,
   -902,
   -905,
-  -907,
-  -909,
+  -908,
   -910,
   -910,
   -910,
   -910,
   -909,
-  -908,
-  -905,
-  -903,
-  -900,
+  -907,
+  -904,
+  -901,
   -896,
   -892,
-  -887,
-  -882,
-  -876,
-  -870,
-  -863,
+  -886,
+  -880,
+  -873,
+  -865,
   -856,
-  -849,
-  -841,
-  -832,
-  -824,
-  -815,
-  -805,
+  -848,
+  -839,
+  -828,
+  -819,
+  -807,
   -795,
-  -785,
-  -775,
-  -764,
-  -752,
-  -741,
-  -729,
+  -784,
+  -772,
+  -758,
+  -745,
+  -731,
   -717,
-  -704,
-  -691,
-  -677,
-  -664,
-  -649,
-  -635,
+  -702,
+  -686,
+  -671,
+  -654,
+  -637,
   -620,
-  -604,
-  -588,
-  -572,
-  -556,
-  -539,
-  -522,
-  -505,
-  -487,
-  -470,
-  -452,
-  -434,
-  -416,
-  -397,
-  -379,
-  -361,
-  -342,
-  -324,
-  -305,
-  -286,
-  -267,
-  -248,
-  -229,
-  -210,
-  -191,
-  -171,
-  -152,
-  -132,
-  -112,
-  -91,
-  -71,
-  -51,
-  -31,
-  -14
+  -601,
+  -582,
+  -564,
+  -544,
+  -524,
+  -504,
+  -483,
+  -463,
+  -442,
+  -421,
+  -399,
+  -378,
+  -356,
+  -334,
+  -313,
+  -290,
+  -268,
+  -246,
+  -224,
+  -202,
+  -178,
+  -156,
+  -133,
+  -109,
+  -85,
+  -61,
+  -38,
+  -17
 };
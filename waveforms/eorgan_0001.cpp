@@ -20,186 +20,159 @@
 #include "waveforms.h"
 const int16_t eorgan_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   3,
-  14,
-  25,
-  35,
-  46,
-  56,
-  66,
+  16,
+  28,
+  41,
+  53,
+  64,
   77,
-  88,
-  98,
-  109,
-  119,
-  130,
-  140,
-  150,
-  161,
-  171,
-  181,
-  191,
-  200,
-  210,
-  220,
-  229,
-  239,
-  248,
-  257,
-  266,
+  90,
+  102,
+  115,
+  127,
+  139,
+  151,
+  164,
+  175,
+  187,
+  198,
+  209,
+  221,
+  232,
+  243,
+  254,
+  264,
   275,
-  284,
-  293,
-  302,
-  310,
-  319,
-  327,
+  285,
+  296,
+  306,
+  316,
+  326,
   336,
-  344,
-  352,
-  360,
-  368,
-  376,
-  383,
+  345,
+  355,
+  364,
+  373,
+  382,
   391,
-  398,
-  406,
-  413,
-  420,
-  428,
-  434,
+  400,
+  409,
+  417,
+  426,
+  433,
   441,
-  448,
-  455,
-  462,
-  468,
-  475,
+  450,
+  458,
+  465,
+  473,
   481,
   487,
-  493,
-  499,
-  505,
-  511,
-  517,
+  495,
+  501,
+  509,
+  516,
   523,
   529,
-  534,
-  540,
-  545,
-  550,
-  556,
+  536,
+  542,
+  548,
+  555,
   561,
-  566,
-  571,
-  576,
-  581,
-  586,
-  591,
+  567,
+  573,
+  578,
+  584,
+  590,
   596,
-  601,
-  606,
-  610,
-  615,
-  620,
+  602,
+  607,
+  612,
+  619,
   624,
   629,
-  633,
-  638,
-  642,
-  647,
-  651,
-  655,
+  634,
+  639,
+  645,
+  650,
+  654,
   660,
-  664,
-  668,
-  673,
-  677,
-  681,
+  665,
+  670,
+  675,
+  680,
   685,
   690,
-  694,
-  698,
-  702,
-  706,
-  710,
+  695,
+  700,
+  704,
+  709,
   714,
   718,
-  722,
-  726,
-  730,
-  735,
+  723,
+  728,
+  733,
   738,
   742,
-  746,
-  750,
-  754,
-  758,
-  762,
-  766,
+  747,
+  751,
+  756,
+  761,
+  765,
   769,
-  773,
-  777,
-  780,
-  784,
-  788,
+  774,
+  778,
+  782,
+  787,
   791,
   795,
-  798,
-  802,
-  805,
-  808,
-  811,
+  799,
+  803,
+  807,
+  810,
   815,
   818,
-  821,
-  824,
-  827,
-  830,
-  833,
+  822,
+  825,
+  829,
+  832,
   836,
   838,
-  841,
-  843,
-  846,
-  849,
+  842,
+  844,
+  848,
   851,
   854,
-  857,
-  860,
-  863,
-  867,
-  871,
-  875,
+  858,
+  861,
+  865,
+  870,
+  874,
   879,
-  883,
-  888,
-  893,
-  899,
-  904,
-  910,
+  884,
+  890,
+  896,
+  902,
+  909,
   916,
-  922,
-  928,
-  934,
-  941,
-  947,
-  953,
+  923,
+  930,
+  938,
+  945,
+  952,
   960,
-  966,
-  972,
-  977,
-  983,
-  988,
-  993,
-  997,
-  1002,
-  1006,
-  1009,
-  1012,
-  1015,
+  967,
+  974,
+  980,
+  987,
+  992,
+  998,
+  1003,
+  1007,
+  1011,
+  1014,
   1018,
   1020,
   1021,
-  1022,
   1023,
   1024,
   1024,
@@ -207,416 +180,355 @@ const int16_t eorgan_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   1023,
   1022,
   1021,
-  1020,
-  1018,
+  1019,
   1016,
   1014,
   1011,
-  1009,
-  1006,
-  1003,
-  999,
+  1008,
+  1005,
+  1000,
   996,
   992,
-  988,
-  984,
-  980,
-  975,
-  970,
+  987,
+  983,
+  977,
+  971,
   966,
   960,
-  955,
-  950,
-  944,
-  938,
-  932,
+  954,
+  948,
+  940,
+  933,
   926,
-  920,
-  913,
-  906,
-  899,
-  892,
-  885,
+  919,
+  911,
+  903,
+  895,
+  886,
   877,
-  869,
-  861,
-  853,
-  844,
-  836,
-  827,
+  868,
+  859,
+  849,
+  839,
+  829,
   818,
-  808,
-  799,
-  789,
-  779,
-  769,
-  759,
+  807,
+  796,
+  784,
+  772,
+  760,
   748,
-  737,
-  727,
-  716,
-  704,
-  693,
-  682,
-  670,
-  659,
-  647,
-  635,
-  623,
-  611,
-  599,
-  586,
-  574,
-  562,
-  549,
-  537,
-  525,
-  512,
-  500,
-  487,
-  475,
-  462,
-  450,
-  437,
+  735,
+  723,
+  709,
+  696,
+  683,
+  669,
+  656,
+  642,
+  628,
+  614,
+  600,
+  585,
+  571,
+  556,
+  542,
+  528,
+  513,
+  498,
+  484,
+  469,
+  454,
+  440,
   425,
-  413,
-  400,
-  388,
-  376,
-  364,
-  352,
+  411,
+  396,
+  382,
+  368,
+  354,
   340,
-  328,
-  316,
-  304,
-  292,
-  281,
-  269,
-  257,
-  246,
-  235,
-  223,
-  212,
-  201,
-  190,
-  179,
-  168,
-  157,
-  147,
-  136,
-  126,
-  115,
-  105,
-  95,
-  85,
-  74,
-  64,
-  55,
+  326,
+  312,
+  298,
+  284,
+  271,
+  256,
+  244,
+  230,
+  217,
+  204,
+  191,
+  178,
+  165,
+  153,
+  141,
+  128,
+  116,
+  104,
+  92,
+  80,
+  68,
+  57,
   45,
-  35,
-  25,
-  16,
-  6,
-  -4,
-  -14,
+  33,
+  22,
+  11,
+  -1,
+  -12,
   -23,
-  -33,
-  -43,
-  -53,
-  -63,
-  -73,
-  -82,
+  -35,
+  -46,
+  -58,
+  -70,
+  -81,
   -92,
-  -101,
-  -111,
-  -120,
-  -130,
-  -139,
-  -148,
-  -158,
-  -167,
-  -176,
-  -185,
-  -194,
-  -203,
-  -212,
-  -221,
-  -230,
-  -239,
-  -248,
-  -257,
-  -265,
+  -103,
+  -114,
+  -125,
+  -137,
+  -147,
+  -159,
+  -169,
+  -180,
+  -190,
+  -201,
+  -211,
+  -222,
+  -232,
+  -243,
+  -254,
+  -263,
   -274,
-  -283,
-  -291,
-  -300,
-  -309,
-  -317,
-  -326,
+  -284,
+  -293,
+  -304,
+  -314,
+  -324,
   -335,
-  -343,
-  -352,
-  -360,
-  -369,
-  -378,
-  -386,
+  -344,
+  -355,
+  -364,
+  -375,
+  -385,
   -395,
-  -403,
-  -412,
-  -420,
-  -429,
-  -438,
-  -446,
+  -405,
+  -415,
+  -425,
+  -436,
+  -445,
   -455,
-  -463,
-  -472,
-  -481,
-  -489,
-  -498,
-  -506,
-  -515,
-  -524,
-  -532,
-  -541,
-  -549,
-  -558,
+  -465,
+  -476,
+  -485,
+  -496,
+  -505,
+  -516,
+  -526,
+  -536,
+  -546,
+  -556,
   -566,
-  -575,
-  -584,
-  -592,
-  -601,
-  -609,
-  -618,
+  -576,
+  -586,
+  -596,
+  -606,
+  -616,
   -626,
-  -635,
-  -643,
-  -652,
-  -660,
-  -668,
-  -677,
+  -636,
+  -646,
+  -656,
+  -665,
+  -675,
   -685,
-  -693,
-  -701,
-  -709,
-  -717,
-  -725,
-  -733,
+  -694,
+  -704,
+  -713,
+  -723,
+  -732,
   -741,
-  -749,
-  -757,
-  -764,
-  -772,
-  -779,
-  -787,
-  -794,
-  -801,
-  -808,
-  -815,
-  -822,
-  -829,
-  -835,
-  -842,
-  -848,
-  -854,
-  -861,
-  -867,
-  -872,
+  -751,
+  -760,
+  -768,
+  -777,
+  -786,
+  -795,
+  -803,
+  -811,
+  -819,
+  -827,
+  -834,
+  -843,
+  -849,
+  -857,
+  -865,
+  -871,
   -878,
-  -884,
-  -889,
-  -894,
-  -900,
-  -904,
-  -909,
+  -885,
+  -890,
+  -897,
+  -903,
+  -908,
   -914,
-  -918,
-  -923,
-  -927,
-  -931,
-  -934,
-  -938,
+  -919,
+  -924,
+  -929,
+  -933,
+  -937,
   -941,
   -945,
-  -948,
-  -951,
-  -953,
-  -956,
+  -949,
+  -952,
+  -955,
   -958,
   -960,
-  -962,
+  -963,
   -964,
-  -965,
-  -967,
+  -966,
   -968,
   -969,
   -969,
   -970,
   -970,
   -971,
-  -971,
   -970,
   -970,
   -969,
   -969,
   -968,
-  -967,
-  -965,
+  -966,
   -964,
   -962,
   -961,
-  -959,
-  -956,
-  -954,
-  -952,
+  -958,
+  -955,
+  -953,
   -949,
   -946,
-  -944,
-  -940,
-  -937,
-  -934,
-  -930,
+  -943,
+  -939,
+  -936,
+  -931,
   -927,
   -923,
-  -919,
-  -915,
-  -911,
-  -907,
-  -903,
-  -898,
+  -918,
+  -914,
+  -909,
+  -904,
+  -899,
   -894,
-  -889,
-  -884,
-  -880,
-  -875,
-  -870,
+  -888,
+  -882,
+  -877,
+  -871,
   -865,
-  -860,
-  -854,
-  -849,
-  -844,
-  -838,
-  -833,
+  -859,
+  -853,
+  -847,
+  -840,
+  -834,
   -828,
-  -822,
-  -816,
-  -811,
-  -805,
-  -800,
-  -794,
+  -821,
+  -815,
+  -808,
+  -802,
+  -795,
   -788,
-  -782,
-  -777,
-  -771,
-  -766,
-  -760,
-  -755,
+  -781,
+  -775,
+  -769,
+  -762,
+  -756,
   -751,
-  -746,
-  -742,
-  -738,
-  -735,
-  -732,
+  -745,
+  -740,
+  -736,
+  -733,
   -730,
   -728,
   -726,
   -725,
   -724,
-  -724,
   -723,
   -723,
   -723,
   -724,
   -724,
-  -724,
   -725,
   -725,
   -725,
   -725,
   -725,
   -725,
-  -724,
   -723,
   -722,
   -720,
   -718,
-  -716,
-  -713,
-  -710,
-  -707,
-  -703,
+  -715,
+  -712,
+  -708,
+  -704,
   -699,
   -694,
-  -690,
-  -684,
-  -679,
-  -673,
-  -667,
+  -688,
+  -681,
+  -675,
+  -668,
   -661,
-  -654,
-  -648,
-  -641,
-  -634,
-  -627,
-  -619,
-  -612,
-  -604,
-  -597,
-  -589,
-  -581,
-  -573,
-  -565,
-  -557,
-  -549,
-  -541,
-  -532,
-  -524,
-  -516,
+  -653,
+  -645,
+  -637,
+  -629,
+  -620,
+  -611,
+  -602,
+  -594,
+  -584,
+  -575,
+  -566,
+  -556,
+  -547,
+  -537,
+  -527,
+  -518,
   -507,
-  -498,
-  -490,
-  -481,
-  -472,
-  -463,
-  -454,
+  -497,
+  -487,
+  -477,
+  -466,
+  -456,
   -445,
-  -435,
-  -426,
-  -417,
-  -407,
-  -397,
-  -387,
+  -434,
+  -423,
+  -412,
+  -400,
+  -389,
   -377,
-  -367,
-  -357,
-  -346,
-  -336,
-  -325,
-  -315,
+  -365,
+  -353,
+  -341,
+  -328,
+  -316,
   -304,
-  -293,
-  -282,
-  -271,
-  -259,
-  -248,
-  -237,
-  -225,
-  -214,
-  -202,
-  -191,
-  -179,
-  -168,
-  -156,
-  -144,
-  -133,
-  -121,
-  -110,
-  -98,
-  -87,
-  -75,
-  -64,
-  -52,
-  -41,
-  -30,
-  -19,
-  -8
+  -290,
+  -278,
+  -264,
+  -251,
+  -238,
+  -224,
+  -211,
+  -197,
+  -184,
+  -171,
+  -157,
+  -143,
+  -130,
+  -116,
+  -103,
+  -89,
+  -76,
+  -62,
+  -49,
+  -36,
+  -23,
+  -10
 };
@@ -20,603 +20,515 @@
 #include "waveforms.h"
 const int16_t epiano_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   6,
-  36,
-  67,
-  96,
-  125,
-  155,
-  186,
-  217,
-  248,
-  278,
-  309,
-  341,
-  374,
-  406,
-  437,
-  468,
-  499,
-  529,
-  560,
-  590,
-  619,
-  647,
-  675,
-  702,
-  728,
-  753,
-  777,
-  800,
-  823,
-  844,
-  864,
-  883,
-  901,
-  918,
+  41,
+  77,
+  111,
+  146,
+  182,
+  218,
+  254,
+  289,
+  326,
+  365,
+  403,
+  439,
+  475,
+  511,
+  547,
+  583,
+  617,
+  650,
+  682,
+  713,
+  743,
+  772,
+  799,
+  826,
+  850,
+  873,
+  895,
+  915,
   933,
-  947,
-  959,
-  971,
-  982,
-  992,
-  1000,
+  949,
+  963,
+  977,
+  989,
+  999,
   1006,
-  1012,
-  1016,
-  1020,
-  1022,
-  1024,
+  1013,
+  1018,
+  1021,
+  1023,
   1024,
   1022,
-  1019,
-  1015,
-  1011,
-  1009,
-  1006,
-  1001,
-  993,
-  984,
-  976,
-  969,
-  962,
-  953,
-  942,
-  931,
-  921,
-  912,
-  903,
-  892,
-  879,
+  1018,
+  1013,
+  1010,
+  1007,
+  1002,
+  992,
+  982,
+  973,
+  965,
+  955,
+  943,
+  930,
+  918,
+  908,
+  896,
+  882,
   867,
-  856,
-  846,
-  835,
-  822,
-  810,
-  799,
+  855,
+  843,
+  829,
+  814,
+  801,
   788,
-  778,
-  766,
-  754,
-  742,
-  732,
-  721,
+  776,
+  762,
+  748,
+  735,
+  723,
   709,
-  696,
-  684,
-  674,
-  664,
-  653,
-  641,
-  630,
-  619,
-  610,
-  600,
-  588,
-  577,
-  567,
-  557,
-  548,
-  537,
-  527,
-  518,
-  510,
-  500,
-  490,
-  480,
-  472,
-  464,
-  456,
-  446,
+  693,
+  680,
+  669,
+  656,
+  642,
+  629,
+  617,
+  606,
+  593,
+  580,
+  568,
+  556,
+  545,
+  532,
+  521,
+  512,
+  501,
+  489,
+  478,
+  468,
+  459,
+  448,
   437,
-  428,
-  421,
-  413,
-  405,
-  397,
-  389,
+  427,
+  418,
+  409,
+  400,
+  390,
   382,
-  375,
-  367,
-  360,
-  353,
-  346,
-  339,
+  373,
+  364,
+  356,
+  348,
+  340,
   331,
-  325,
-  318,
-  312,
-  305,
-  298,
-  291,
-  286,
-  280,
-  274,
-  267,
-  261,
-  255,
+  323,
+  316,
+  308,
+  300,
+  292,
+  285,
+  279,
+  271,
+  263,
+  256,
   249,
-  243,
-  238,
-  232,
-  226,
-  220,
-  213,
+  242,
+  236,
+  229,
+  222,
+  214,
   208,
-  203,
-  197,
-  192,
-  185,
-  179,
-  173,
+  202,
+  196,
+  189,
+  181,
+  174,
   167,
-  162,
-  156,
-  150,
-  144,
-  138,
-  132,
+  161,
+  154,
+  147,
+  140,
+  133,
   127,
-  121,
-  115,
-  109,
-  103,
-  97,
+  120,
+  113,
+  106,
+  99,
   92,
   86,
-  80,
-  73,
-  67,
-  61,
-  56,
-  50,
-  43,
-  37,
-  31,
-  25,
-  19,
-  14,
-  7,
-  1,
-  -6,
-  -12,
-  -18,
-  -24,
-  -30,
+  78,
+  71,
+  63,
+  57,
+  51,
+  42,
+  35,
+  28,
+  21,
+  15,
+  8,
+  0,
+  -8,
+  -15,
+  -22,
+  -29,
   -36,
-  -43,
-  -49,
-  -56,
-  -62,
-  -68,
-  -74,
+  -44,
+  -51,
+  -59,
+  -66,
+  -73,
   -80,
-  -87,
-  -94,
-  -100,
-  -105,
-  -111,
-  -117,
+  -88,
+  -96,
+  -103,
+  -109,
+  -116,
   -124,
-  -130,
-  -136,
-  -143,
-  -149,
-  -155,
+  -131,
+  -139,
+  -147,
+  -153,
   -161,
   -167,
-  -173,
-  -179,
-  -185,
-  -191,
-  -197,
+  -175,
+  -181,
+  -189,
+  -196,
   -203,
-  -210,
-  -216,
-  -222,
-  -228,
-  -234,
-  -240,
+  -211,
+  -218,
+  -225,
+  -232,
+  -239,
   -247,
-  -253,
-  -259,
-  -264,
-  -270,
-  -276,
-  -282,
+  -254,
+  -261,
+  -267,
+  -274,
+  -281,
   -289,
-  -294,
-  -300,
-  -306,
-  -313,
-  -319,
-  -325,
+  -295,
+  -302,
+  -310,
+  -317,
+  -324,
   -331,
-  -337,
-  -343,
-  -350,
-  -356,
-  -362,
-  -368,
+  -338,
+  -346,
+  -353,
+  -360,
+  -367,
   -374,
-  -380,
-  -386,
-  -392,
-  -399,
-  -406,
-  -413,
-  -418,
-  -424,
-  -430,
-  -437,
-  -444,
-  -450,
+  -381,
+  -388,
+  -396,
+  -404,
+  -412,
+  -419,
+  -425,
+  -433,
+  -441,
+  -449,
   -456,
-  -462,
-  -468,
-  -475,
-  -482,
-  -488,
-  -494,
+  -463,
+  -470,
+  -478,
+  -486,
+  -493,
   -500,
-  -507,
-  -513,
-  -519,
-  -526,
-  -532,
-  -538,
+  -508,
+  -515,
+  -523,
+  -530,
+  -537,
   -545,
-  -551,
-  -557,
-  -564,
-  -570,
-  -576,
-  -582,
+  -552,
+  -559,
+  -567,
+  -574,
+  -581,
   -588,
-  -595,
-  -602,
-  -608,
-  -614,
-  -619,
-  -625,
-  -631,
-  -638,
-  -644,
-  -649,
-  -654,
-  -660,
+  -597,
+  -604,
+  -611,
+  -618,
+  -624,
+  -632,
+  -640,
+  -646,
+  -652,
+  -658,
   -666,
   -672,
-  -677,
-  -682,
-  -686,
-  -691,
-  -697,
+  -679,
+  -684,
+  -689,
+  -696,
   -702,
   -707,
-  -711,
-  -716,
-  -720,
-  -724,
-  -729,
+  -713,
+  -718,
+  -723,
+  -728,
   -734,
-  -738,
-  -741,
-  -744,
-  -748,
-  -752,
-  -756,
+  -739,
+  -742,
+  -746,
+  -751,
+  -755,
   -759,
   -761,
-  -763,
-  -765,
-  -767,
-  -770,
+  -764,
+  -766,
+  -769,
   -772,
   -773,
   -775,
   -776,
   -777,
   -777,
-  -777,
   -778,
   -777,
   -777,
   -776,
-  -775,
-  -773,
+  -774,
   -772,
   -769,
-  -767,
-  -763,
-  -760,
-  -756,
-  -751,
-  -747,
+  -766,
+  -762,
+  -758,
+  -753,
+  -748,
   -741,
-  -735,
-  -728,
-  -722,
-  -714,
-  -706,
-  -697,
+  -734,
+  -726,
+  -718,
+  -709,
+  -699,
   -686,
-  -675,
-  -664,
-  -653,
-  -640,
-  -625,
-  -610,
-  -594,
-  -578,
-  -561,
-  -543,
-  -524,
-  -504,
-  -484,
-  -462,
-  -439,
-  -416,
-  -392,
-  -367,
-  -342,
-  -315,
-  -288,
-  -260,
-  -232,
-  -203,
-  -174,
-  -143,
-  -113,
-  -83,
-  -53,
-  -21,
-  11,
-  42,
-  73,
+  -673,
+  -660,
+  -646,
+  -629,
+  -612,
+  -593,
+  -574,
+  -554,
+  -532,
+  -509,
+  -486,
+  -460,
+  -433,
+  -406,
+  -377,
+  -348,
+  -317,
+  -285,
+  -252,
+  -219,
+  -185,
+  -149,
+  -114,
+  -79,
+  -43,
+  -5,
+  31,
+  68,
   103,
-  133,
-  163,
-  193,
-  223,
-  252,
-  280,
-  308,
-  335,
-  361,
-  386,
-  410,
-  433,
-  455,
-  476,
-  496,
-  515,
-  533,
-  550,
-  565,
-  579,
-  592,
-  603,
-  614,
-  623,
-  630,
-  637,
+  138,
+  173,
+  208,
+  243,
+  276,
+  309,
+  340,
+  370,
+  399,
+  427,
+  453,
+  477,
+  501,
+  522,
+  543,
+  561,
+  578,
+  593,
+  606,
+  618,
+  627,
+  636,
   642,
   647,
-  650,
-  653,
+  651,
   654,
   654,
   653,
   650,
   648,
-  645,
-  640,
-  634,
-  628,
-  621,
+  644,
+  637,
+  630,
+  622,
   614,
-  606,
-  597,
-  587,
-  577,
-  567,
-  556,
-  545,
-  533,
-  521,
-  509,
-  497,
-  484,
-  472,
-  459,
-  446,
-  432,
-  418,
-  404,
-  391,
-  378,
-  365,
-  351,
-  336,
-  322,
-  310,
-  297,
+  604,
+  593,
+  582,
+  570,
+  557,
+  544,
+  530,
+  516,
+  502,
+  487,
+  473,
+  458,
+  443,
+  426,
+  410,
+  394,
+  379,
+  363,
+  347,
+  329,
+  314,
+  300,
   284,
-  271,
-  258,
-  244,
-  231,
-  219,
-  206,
+  269,
+  254,
+  237,
+  223,
+  208,
   194,
-  181,
-  168,
-  157,
-  146,
-  135,
-  124,
+  179,
+  164,
+  151,
+  138,
+  126,
   112,
-  100,
-  89,
-  79,
-  69,
-  59,
-  48,
-  38,
-  28,
-  19,
-  9,
-  0,
-  -9,
+  98,
+  85,
+  74,
+  62,
+  49,
+  37,
+  26,
+  15,
+  4,
+  -7,
   -17,
-  -26,
-  -34,
-  -42,
-  -50,
-  -59,
-  -67,
+  -27,
+  -36,
+  -45,
+  -56,
+  -65,
   -76,
-  -84,
-  -91,
-  -98,
-  -105,
-  -113,
-  -121,
+  -85,
+  -93,
+  -101,
+  -110,
+  -119,
   -128,
-  -135,
-  -140,
-  -147,
-  -154,
-  -162,
-  -168,
+  -136,
+  -142,
+  -150,
+  -159,
+  -167,
   -174,
-  -179,
-  -186,
-  -193,
-  -200,
-  -206,
-  -211,
+  -180,
+  -188,
+  -197,
+  -204,
+  -210,
   -217,
-  -223,
-  -229,
-  -236,
-  -241,
-  -246,
+  -224,
+  -232,
+  -239,
+  -245,
   -251,
   -257,
-  -263,
-  -269,
-  -274,
-  -280,
-  -286,
+  -265,
+  -271,
+  -277,
+  -285,
   -292,
-  -298,
-  -303,
-  -308,
-  -313,
-  -319,
-  -325,
+  -299,
+  -304,
+  -310,
+  -317,
+  -324,
   -330,
-  -335,
-  -340,
-  -346,
-  -352,
-  -357,
-  -361,
+  -336,
+  -342,
+  -349,
+  -355,
+  -360,
   -366,
-  -372,
-  -378,
-  -383,
-  -388,
-  -393,
+  -373,
+  -380,
+  -386,
+  -391,
   -397,
   -402,
-  -407,
-  -413,
-  -417,
-  -422,
-  -426,
-  -430,
+  -408,
+  -415,
+  -420,
+  -425,
+  -429,
   -434,
-  -439,
-  -443,
-  -447,
-  -451,
-  -455,
+  -440,
+  -445,
+  -449,
+  -454,
   -459,
   -463,
-  -466,
-  -469,
-  -472,
-  -475,
+  -467,
+  -470,
+  -474,
   -477,
   -480,
   -482,
-  -484,
-  -486,
+  -485,
   -487,
   -488,
   -489,
   -489,
   -489,
   -488,
-  -487,
   -486,
   -485,
   -483,
   -481,
-  -478,
-  -475,
-  -471,
-  -466,
-  -460,
-  -454,
+  -477,
+  -474,
+  -468,
+  -462,
+  -455,
   -448,
-  -442,
-  -434,
-  -426,
-  -417,
-  -408,
-  -398,
-  -387,
-  -375,
-  -361,
-  -348,
-  -334,
-  -319,
-  -303,
-  -286,
-  -268,
-  -250,
-  -232,
-  -211,
-  -190,
-  -168,
-  -146,
-  -123,
-  -99,
-  -74,
-  -48,
-  -21
+  -440,
+  -431,
+  -421,
+  -410,
+  -399,
+  -386,
+  -372,
+  -355,
+  -340,
+  -323,
+  -304,
+  -284,
+  -263,
+  -242,
+  -219,
+  -194,
+  -169,
+  -143,
+  -116,
+  -87,
+  -57,
+  -26
 };
@@ -20,479 +20,409 @@
 #include "waveforms.h"
 const int16_t flute_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   7,
-  16,
-  25,
-  35,
-  46,
-  57,
-  67,
+  18,
+  28,
+  41,
+  54,
+  66,
   77,
-  86,
-  95,
-  103,
-  110,
-  116,
-  121,
+  88,
+  98,
+  107,
+  114,
+  120,
   125,
-  129,
-  133,
-  137,
-  141,
-  146,
+  130,
+  135,
+  139,
+  145,
   151,
-  157,
-  163,
-  168,
-  173,
-  177,
-  181,
+  158,
+  164,
+  170,
+  176,
+  180,
   183,
   184,
   185,
   185,
   185,
-  185,
   184,
   184,
   184,
   186,
-  187,
-  189,
-  192,
-  195,
+  188,
+  191,
+  194,
   197,
   200,
-  202,
-  204,
-  206,
-  208,
+  203,
+  205,
+  207,
   210,
   212,
-  215,
-  219,
-  223,
-  228,
-  233,
-  239,
-  246,
-  254,
-  261,
-  269,
-  276,
-  283,
+  216,
+  221,
+  226,
+  232,
+  238,
+  247,
+  256,
+  264,
+  273,
+  281,
   289,
   295,
-  300,
-  306,
-  311,
-  316,
-  322,
+  302,
+  308,
+  314,
+  321,
   327,
-  333,
-  338,
-  344,
-  349,
-  353,
-  358,
+  334,
+  340,
+  347,
+  352,
+  357,
   362,
   365,
-  367,
-  369,
-  371,
+  368,
+  370,
   372,
   373,
   374,
   375,
   376,
-  377,
-  380,
+  379,
   382,
   385,
   389,
-  392,
-  396,
-  399,
-  401,
+  393,
+  397,
+  400,
   403,
   404,
   405,
   406,
   406,
-  407,
   408,
-  410,
+  409,
   412,
   415,
-  418,
-  422,
-  426,
-  431,
-  435,
+  419,
+  424,
+  429,
+  434,
   440,
-  445,
-  450,
-  456,
-  461,
-  467,
-  472,
+  446,
+  452,
+  459,
+  465,
+  471,
   477,
-  482,
-  487,
-  492,
-  497,
-  502,
-  507,
+  483,
+  489,
+  495,
+  500,
+  506,
   513,
-  519,
-  525,
-  532,
-  540,
-  548,
-  556,
-  564,
-  573,
-  582,
-  591,
-  600,
-  608,
-  617,
-  625,
-  634,
-  643,
-  652,
-  660,
-  669,
+  520,
+  528,
+  536,
+  546,
+  555,
+  565,
+  575,
+  586,
+  596,
+  606,
+  616,
+  626,
+  636,
+  647,
+  657,
+  667,
   676,
-  684,
-  691,
-  698,
-  705,
-  711,
-  718,
+  685,
+  693,
+  701,
+  709,
+  717,
   726,
-  733,
-  741,
-  749,
-  756,
-  763,
-  769,
+  734,
+  744,
+  753,
+  761,
+  768,
   776,
-  781,
-  787,
-  793,
-  799,
-  805,
-  813,
-  820,
-  829,
-  838,
-  846,
-  855,
-  863,
-  872,
-  880,
-  888,
-  896,
-  903,
-  909,
-  916,
+  782,
+  789,
+  796,
+  803,
+  812,
+  821,
+  831,
+  841,
+  851,
+  861,
+  871,
+  881,
+  890,
+  899,
+  906,
+  915,
   922,
-  928,
-  935,
-  941,
-  947,
-  954,
-  961,
+  929,
+  937,
+  944,
+  951,
+  960,
   968,
-  975,
-  982,
-  989,
-  995,
-  1000,
-  1005,
+  976,
+  984,
+  992,
+  998,
+  1004,
   1009,
   1012,
-  1014,
-  1016,
-  1018,
+  1015,
+  1017,
   1019,
   1021,
   1022,
   1023,
   1024,
   1024,
-  1023,
-  1021,
+  1022,
   1018,
   1014,
-  1010,
-  1006,
-  1001,
-  996,
-  990,
+  1009,
+  1004,
+  998,
+  991,
   984,
-  977,
-  970,
-  962,
-  954,
-  946,
-  939,
+  976,
+  968,
+  958,
+  949,
+  940,
   932,
-  926,
-  921,
-  916,
-  911,
-  908,
-  904,
+  925,
+  920,
+  913,
+  909,
+  905,
   901,
-  898,
-  894,
-  891,
-  888,
-  885,
-  881,
+  897,
+  893,
+  889,
+  886,
+  882,
   877,
-  872,
-  868,
-  864,
-  860,
-  857,
+  871,
+  867,
+  862,
+  858,
   853,
   850,
-  847,
-  844,
-  840,
-  835,
-  830,
+  846,
+  843,
+  837,
+  831,
   824,
   817,
-  810,
-  801,
-  793,
-  783,
-  773,
-  763,
-  752,
-  740,
-  728,
-  716,
-  702,
-  687,
+  808,
+  798,
+  787,
+  775,
+  764,
+  750,
+  736,
+  722,
+  707,
+  690,
   672,
-  655,
-  638,
-  620,
-  601,
-  582,
-  562,
+  652,
+  632,
+  610,
+  588,
+  565,
   543,
-  523,
-  503,
-  484,
-  464,
-  445,
-  426,
-  408,
-  390,
-  373,
-  356,
-  339,
-  322,
-  306,
-  288,
-  271,
-  254,
-  237,
-  219,
-  201,
-  183,
-  164,
-  146,
-  128,
-  109,
-  91,
-  73,
-  54,
-  37,
-  20,
-  4,
-  -13,
-  -28,
-  -42,
+  519,
+  496,
+  473,
+  450,
+  428,
+  407,
+  386,
+  366,
+  346,
+  326,
+  307,
+  287,
+  267,
+  247,
+  226,
+  205,
+  184,
+  162,
+  141,
+  119,
+  98,
+  77,
+  55,
+  34,
+  15,
+  -4,
+  -23,
+  -40,
   -56,
-  -69,
-  -82,
-  -94,
-  -105,
-  -115,
-  -124,
+  -71,
+  -86,
+  -100,
+  -112,
+  -123,
   -133,
-  -141,
-  -148,
-  -155,
-  -160,
-  -166,
+  -142,
+  -151,
+  -158,
+  -164,
   -171,
   -175,
-  -179,
-  -183,
-  -185,
-  -188,
+  -180,
+  -184,
+  -187,
   -189,
   -189,
   -190,
   -189,
   -189,
   -188,
-  -188,
   -189,
   -191,
   -194,
-  -197,
-  -201,
-  -205,
-  -209,
+  -198,
+  -203,
+  -208,
   -212,
   -215,
-  -218,
-  -221,
-  -223,
-  -226,
-  -230,
+  -219,
+  -222,
+  -224,
+  -229,
   -233,
   -238,
-  -243,
-  -248,
-  -254,
-  -260,
-  -267,
-  -273,
+  -244,
+  -250,
+  -257,
+  -265,
+  -272,
   -280,
-  -288,
-  -296,
-  -303,
-  -312,
-  -320,
-  -329,
-  -337,
-  -346,
-  -355,
-  -364,
-  -372,
-  -380,
+  -290,
+  -299,
+  -308,
+  -318,
+  -328,
+  -338,
+  -348,
+  -359,
+  -369,
+  -378,
   -387,
-  -394,
-  -400,
-  -405,
-  -410,
-  -414,
-  -417,
+  -395,
+  -401,
+  -407,
+  -413,
+  -416,
   -420,
   -422,
   -424,
-  -425,
   -426,
   -426,
   -427,
   -428,
   -430,
-  -432,
-  -434,
-  -436,
-  -439,
+  -433,
+  -435,
+  -438,
   -441,
   -444,
   -447,
-  -449,
-  -452,
-  -455,
-  -458,
+  -450,
+  -454,
+  -457,
   -462,
   -466,
-  -470,
-  -474,
-  -477,
-  -481,
-  -484,
+  -471,
+  -475,
+  -479,
+  -483,
   -487,
   -490,
-  -494,
-  -498,
-  -502,
-  -506,
-  -511,
+  -495,
+  -500,
+  -504,
+  -510,
   -515,
-  -520,
-  -525,
-  -529,
-  -533,
-  -537,
-  -541,
+  -521,
+  -526,
+  -531,
+  -536,
+  -540,
   -545,
   -548,
-  -551,
-  -555,
-  -558,
-  -562,
+  -552,
+  -557,
+  -560,
   -566,
   -569,
-  -574,
-  -578,
-  -581,
-  -585,
-  -588,
+  -575,
+  -579,
+  -583,
+  -587,
   -591,
   -594,
-  -598,
-  -602,
-  -606,
-  -612,
-  -618,
-  -625,
-  -632,
-  -638,
-  -644,
-  -650,
-  -655,
-  -659,
+  -599,
+  -603,
+  -609,
+  -616,
+  -624,
+  -633,
+  -639,
+  -647,
+  -653,
+  -658,
   -664,
-  -671,
-  -677,
-  -685,
-  -694,
-  -704,
-  -714,
-  -725,
-  -734,
-  -743,
-  -752,
-  -760,
-  -767,
-  -774,
+  -672,
+  -679,
+  -689,
+  -700,
+  -712,
+  -724,
+  -735,
+  -746,
+  -756,
+  -765,
+  -773,
   -781,
-  -788,
-  -796,
-  -804,
-  -813,
-  -822,
-  -832,
+  -789,
+  -799,
+  -809,
+  -819,
+  -831,
   -842,
-  -852,
-  -863,
-  -872,
-  -881,
-  -889,
-  -897,
-  -903,
-  -909,
-  -914,
-  -919,
-  -923,
-  -926,
+  -854,
+  -867,
+  -877,
+  -887,
+  -896,
+  -904,
+  -910,
+  -916,
+  -921,
+  -925,
   -929,
   -931,
   -932,
-  -933,
   -934,
   -934,
   -934,
@@ -502,26 +432,22 @@ const int16_t flute_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   -932,
   -932,
   -932,
-  -932,
   -933,
   -935,
-  -937,
-  -939,
-  -942,
-  -945,
+  -938,
+  -940,
+  -944,
   -948,
   -951,
-  -954,
-  -958,
-  -961,
-  -965,
-  -969,
+  -955,
+  -959,
+  -963,
+  -968,
   -972,
   -976,
-  -980,
-  -984,
-  -987,
-  -990,
+  -981,
+  -985,
+  -989,
   -992,
   -994,
   -995,
@@ -529,94 +455,80 @@ const int16_t flute_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   -996,
   -996,
   -996,
-  -996,
   -995,
   -993,
   -992,
-  -990,
-  -987,
-  -984,
-  -980,
+  -989,
+  -985,
+  -981,
   -975,
-  -970,
-  -964,
-  -957,
-  -949,
-  -940,
-  -930,
+  -969,
+  -962,
+  -953,
+  -943,
+  -932,
   -920,
-  -910,
-  -899,
-  -888,
-  -877,
-  -866,
-  -854,
+  -908,
+  -895,
+  -882,
+  -869,
+  -856,
   -843,
-  -832,
-  -821,
-  -811,
-  -800,
-  -790,
-  -780,
-  -770,
-  -760,
-  -751,
-  -741,
-  -732,
-  -722,
-  -713,
-  -704,
-  -695,
-  -687,
-  -678,
-  -670,
-  -663,
+  -830,
+  -817,
+  -805,
+  -793,
+  -781,
+  -769,
+  -758,
+  -747,
+  -736,
+  -724,
+  -714,
+  -703,
+  -693,
+  -683,
+  -673,
+  -664,
   -656,
-  -649,
-  -643,
-  -637,
-  -630,
-  -624,
-  -616,
+  -648,
+  -641,
+  -634,
+  -626,
+  -618,
   -609,
-  -600,
-  -591,
-  -582,
-  -572,
-  -562,
-  -551,
+  -599,
+  -588,
+  -577,
+  -565,
+  -553,
   -540,
-  -528,
-  -516,
-  -503,
-  -489,
-  -474,
-  -460,
-  -444,
-  -429,
-  -413,
-  -397,
-  -381,
-  -364,
-  -347,
-  -329,
-  -312,
-  -294,
-  -275,
-  -256,
-  -238,
-  -218,
-  -200,
-  -181,
-  -163,
-  -144,
-  -125,
-  -108,
-  -90,
-  -73,
-  -57,
-  -41,
-  -26,
-  -13,
-  -2
+  -526,
+  -511,
+  -496,
+  -478,
+  -462,
+  -443,
+  -426,
+  -407,
+  -388,
+  -369,
+  -349,
+  -328,
+  -308,
+  -286,
+  -264,
+  -242,
+  -219,
+  -198,
+  -176,
+  -155,
+  -132,
+  -111,
+  -91,
+  -71,
+  -52,
+  -33,
+  -17,
+  -4
 };
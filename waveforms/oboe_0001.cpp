@@ -20,132 +20,113 @@
 #include "waveforms.h"
 const int16_t oboe_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   12,
-  31,
-  49,
-  67,
-  86,
-  104,
-  121,
-  139,
-  157,
-  174,
-  191,
-  208,
-  225,
-  241,
-  258,
-  274,
-  289,
-  305,
-  320,
-  335,
-  350,
-  365,
-  379,
-  393,
-  407,
-  420,
-  433,
+  34,
+  55,
+  77,
+  99,
+  119,
+  140,
+  160,
+  180,
+  200,
+  220,
+  239,
+  259,
+  278,
+  295,
+  314,
+  331,
+  349,
+  366,
+  383,
+  399,
+  415,
+  430,
   446,
-  459,
-  471,
-  483,
-  495,
-  507,
-  518,
+  460,
+  475,
+  489,
+  503,
+  516,
   529,
-  540,
-  550,
-  561,
-  571,
-  581,
-  590,
+  541,
+  554,
+  566,
+  578,
+  589,
   600,
-  609,
-  618,
-  627,
-  636,
-  644,
-  653,
+  611,
+  621,
+  632,
+  642,
+  652,
   661,
-  669,
-  677,
-  684,
-  692,
-  699,
-  706,
-  714,
-  721,
-  728,
-  735,
-  741,
-  748,
+  671,
+  680,
+  688,
+  697,
+  705,
+  715,
+  723,
+  731,
+  739,
+  746,
   755,
-  761,
-  768,
-  775,
-  781,
-  787,
-  794,
+  762,
+  770,
+  778,
+  785,
+  793,
   800,
-  806,
-  812,
-  818,
-  824,
-  830,
-  836,
+  807,
+  814,
+  821,
+  828,
+  835,
   842,
-  848,
-  854,
-  860,
-  865,
-  871,
-  877,
+  849,
+  856,
+  863,
+  869,
+  876,
   882,
-  888,
-  893,
-  898,
-  903,
-  908,
+  889,
+  895,
+  901,
+  907,
   913,
   918,
-  922,
-  927,
-  931,
-  935,
-  939,
+  923,
+  929,
+  933,
+  938,
   943,
   947,
-  951,
-  955,
-  958,
-  962,
-  965,
+  952,
+  956,
+  960,
+  964,
   968,
   971,
-  974,
-  977,
-  980,
-  982,
-  985,
+  975,
+  979,
+  981,
+  984,
   987,
   990,
-  992,
-  994,
-  996,
-  998,
+  993,
+  995,
+  997,
   1000,
   1001,
   1003,
-  1004,
-  1006,
+  1005,
   1007,
   1008,
   1009,
   1010,
   1011,
   1012,
-  1012,
   1013,
   1013,
   1013,
@@ -153,245 +134,209 @@ const int16_t oboe_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   1013,
   1013,
   1012,
-  1012,
   1011,
   1010,
   1009,
   1008,
   1007,
-  1006,
-  1004,
+  1005,
   1003,
   1001,
   1000,
-  998,
-  996,
-  994,
-  992,
+  997,
+  995,
+  993,
   990,
   988,
   985,
-  983,
-  980,
-  978,
-  975,
+  982,
+  979,
+  976,
   972,
   968,
-  965,
-  961,
-  957,
-  953,
-  949,
+  964,
+  960,
+  955,
+  950,
   945,
   940,
-  935,
-  930,
-  925,
-  919,
-  914,
-  908,
-  902,
-  896,
-  890,
-  883,
-  876,
-  870,
-  862,
-  855,
-  848,
-  840,
-  832,
-  825,
-  816,
+  934,
+  928,
+  922,
+  915,
+  909,
+  901,
+  894,
+  887,
+  879,
+  871,
+  863,
+  854,
+  846,
+  836,
+  828,
+  818,
   808,
-  800,
-  791,
-  782,
-  773,
-  764,
-  755,
+  799,
+  788,
+  778,
+  767,
+  756,
   746,
-  736,
-  726,
-  716,
-  707,
-  696,
-  686,
+  734,
+  722,
+  711,
+  699,
+  687,
   676,
-  666,
-  655,
-  645,
-  635,
-  624,
-  613,
-  603,
-  592,
-  582,
-  571,
-  560,
-  549,
-  539,
-  528,
-  516,
-  505,
-  494,
-  482,
-  470,
+  664,
+  651,
+  639,
+  627,
+  614,
+  602,
+  590,
+  577,
+  564,
+  552,
+  540,
+  527,
+  513,
+  500,
+  487,
+  472,
   458,
-  445,
-  433,
-  421,
-  408,
-  396,
-  383,
+  443,
+  429,
+  415,
+  400,
+  385,
   371,
-  358,
-  345,
-  333,
-  321,
-  309,
-  298,
+  356,
+  341,
+  327,
+  313,
+  300,
   286,
-  275,
-  264,
-  253,
-  243,
-  233,
-  223,
-  213,
-  203,
-  193,
-  183,
-  173,
-  164,
-  154,
-  144,
-  134,
-  124,
-  115,
-  105,
-  96,
-  86,
-  77,
-  68,
-  59,
-  50,
-  41,
-  32,
+  273,
+  260,
+  247,
+  236,
+  224,
+  212,
+  201,
+  189,
+  177,
+  166,
+  155,
+  143,
+  131,
+  120,
+  109,
+  98,
+  87,
+  76,
+  65,
+  55,
+  44,
+  34,
   24,
-  16,
-  8,
-  0,
-  -8,
-  -15,
-  -23,
+  15,
+  6,
+  -4,
+  -13,
+  -22,
   -30,
-  -37,
-  -44,
-  -50,
-  -57,
-  -63,
-  -70,
+  -38,
+  -46,
+  -54,
+  -61,
+  -69,
   -76,
-  -82,
-  -88,
-  -94,
-  -100,
-  -106,
+  -83,
+  -90,
+  -97,
+  -104,
   -111,
   -117,
-  -122,
-  -128,
-  -133,
-  -138,
-  -143,
+  -124,
+  -130,
+  -136,
+  -142,
   -147,
   -152,
-  -156,
-  -160,
-  -164,
-  -168,
-  -171,
+  -157,
+  -162,
+  -167,
+  -170,
   -174,
   -178,
-  -181,
-  -184,
-  -188,
-  -191,
-  -194,
+  -182,
+  -186,
+  -190,
+  -193,
   -198,
-  -202,
-  -205,
-  -209,
-  -214,
-  -218,
-  -223,
+  -203,
+  -206,
+  -212,
+  -217,
+  -222,
   -228,
-  -232,
-  -237,
-  -242,
-  -247,
-  -252,
-  -257,
+  -233,
+  -239,
+  -245,
+  -251,
+  -256,
   -262,
-  -267,
-  -271,
-  -276,
-  -280,
-  -285,
+  -268,
+  -273,
+  -278,
+  -284,
   -289,
   -293,
-  -297,
-  -301,
-  -304,
-  -308,
-  -312,
+  -298,
+  -302,
+  -306,
+  -311,
   -316,
-  -319,
-  -323,
-  -327,
-  -331,
-  -334,
-  -338,
+  -320,
+  -324,
+  -329,
+  -333,
+  -337,
   -342,
-  -346,
-  -350,
-  -353,
-  -357,
-  -361,
+  -347,
+  -351,
+  -355,
+  -360,
   -364,
   -368,
-  -371,
-  -375,
-  -378,
-  -381,
-  -384,
+  -372,
+  -376,
+  -380,
+  -383,
   -387,
   -390,
-  -393,
-  -396,
-  -398,
-  -401,
+  -394,
+  -397,
+  -400,
   -403,
   -406,
   -408,
   -410,
-  -412,
-  -414,
-  -416,
+  -413,
+  -415,
   -418,
   -419,
   -421,
-  -422,
-  -424,
+  -423,
+  -425,
   -425,
-  -426,
   -428,
   -428,
   -429,
   -430,
   -431,
-  -431,
   -432,
   -432,
   -432,
@@ -399,40 +344,34 @@ const int16_t oboe_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   -432,
   -431,
   -431,
-  -431,
   -430,
   -429,
   -429,
   -428,
-  -427,
   -426,
   -425,
   -424,
   -423,
   -422,
   -421,
-  -420,
-  -418,
+  -419,
   -417,
   -416,
   -415,
   -413,
   -412,
-  -411,
   -410,
   -408,
   -407,
   -406,
   -405,
   -404,
-  -403,
   -402,
   -401,
   -401,
   -400,
   -399,
   -399,
-  -398,
   -397,
   -397,
   -397,
@@ -443,100 +382,85 @@ const int16_t oboe_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   -396,
   -396,
   -396,
-  -396,
   -397,
   -397,
-  -398,
   -399,
   -401,
   -402,
-  -404,
-  -407,
-  -409,
-  -412,
-  -415,
+  -405,
+  -408,
+  -411,
+  -414,
   -418,
   -422,
-  -426,
-  -430,
-  -434,
-  -438,
-  -443,
+  -427,
+  -432,
+  -436,
+  -442,
   -448,
-  -453,
-  -458,
-  -463,
-  -468,
-  -474,
-  -479,
+  -454,
+  -460,
+  -465,
+  -472,
+  -478,
   -485,
-  -491,
-  -497,
-  -504,
-  -510,
-  -517,
-  -524,
+  -492,
+  -499,
+  -507,
+  -515,
+  -523,
   -531,
-  -537,
-  -544,
-  -552,
-  -559,
-  -566,
-  -574,
+  -538,
+  -547,
+  -556,
+  -564,
+  -573,
   -582,
-  -589,
-  -597,
-  -605,
-  -613,
-  -622,
-  -631,
-  -639,
-  -648,
-  -658,
-  -667,
-  -677,
-  -687,
-  -698,
-  -708,
-  -718,
-  -729,
-  -740,
-  -751,
-  -762,
+  -591,
+  -600,
+  -610,
+  -620,
+  -630,
+  -640,
+  -651,
+  -662,
+  -673,
+  -685,
+  -697,
+  -709,
+  -721,
+  -734,
+  -747,
+  -760,
   -773,
-  -784,
-  -795,
-  -805,
-  -816,
-  -827,
-  -837,
+  -786,
+  -798,
+  -810,
+  -824,
+  -835,
   -847,
-  -857,
-  -867,
-  -877,
-  -886,
-  -896,
-  -905,
+  -859,
+  -871,
+  -882,
+  -893,
+  -904,
   -914,
-  -923,
-  -931,
-  -939,
-  -946,
-  -954,
+  -925,
+  -934,
+  -943,
+  -952,
   -961,
   -967,
-  -973,
-  -979,
-  -984,
-  -990,
-  -994,
-  -999,
-  -1003,
-  -1007,
-  -1010,
-  -1014,
-  -1017,
-  -1020,
+  -975,
+  -981,
+  -988,
+  -993,
+  -998,
+  -1004,
+  -1008,
+  -1012,
+  -1016,
+  -1019,
   -1022,
   -1024,
   -1024,
@@ -549,74 +473,62 @@ const int16_t oboe_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   -1024,
   -1024,
   -1024,
-  -1024,
-  -1024,
   -1021,
-  -1017,
-  -1013,
-  -1008,
-  -1003,
-  -997,
-  -990,
+  -1016,
+  -1011,
+  -1005,
+  -999,
+  -991,
   -983,
-  -976,
-  -968,
-  -959,
-  -951,
-  -941,
-  -932,
-  -921,
-  -911,
-  -900,
-  -888,
-  -877,
-  -864,
+  -974,
+  -964,
+  -954,
+  -944,
+  -933,
+  -920,
+  -908,
+  -895,
+  -881,
+  -867,
   -851,
-  -838,
-  -825,
-  -811,
-  -797,
-  -782,
-  -767,
+  -837,
+  -821,
+  -805,
+  -787,
+  -770,
   -752,
-  -736,
-  -720,
-  -704,
-  -687,
-  -670,
-  -653,
+  -734,
+  -715,
+  -696,
+  -675,
+  -656,
   -636,
-  -618,
-  -600,
-  -582,
-  -564,
-  -545,
-  -526,
-  -507,
-  -488,
-  -469,
-  -450,
-  -430,
-  -411,
-  -392,
-  -373,
-  -353,
-  -333,
-  -314,
-  -294,
-  -274,
-  -255,
-  -235,
-  -215,
-  -196,
-  -176,
-  -157,
-  -138,
-  -119,
-  -100,
-  -81,
-  -62,
-  -43,
-  -24,
-  -6
+  -615,
+  -593,
+  -573,
+  -551,
+  -528,
+  -506,
+  -484,
+  -462,
+  -439,
+  -416,
+  -394,
+  -371,
+  -348,
+  -325,
+  -302,
+  -278,
+  -256,
+  -233,
+  -210,
+  -187,
+  -164,
+  -142,
+  -120,
+  -97,
+  -75,
+  -53,
+  -30,
+  -9
 };
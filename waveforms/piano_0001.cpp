@@ -20,603 +20,515 @@
 #include "waveforms.h"
 const int16_t piano_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   3,
-  27,
-  54,
-  83,
-  113,
-  143,
-  172,
-  199,
-  223,
-  241,
-  255,
-  264,
+  31,
+  64,
+  98,
+  134,
+  168,
+  200,
+  227,
+  247,
+  261,
   266,
   265,
   260,
-  254,
-  249,
-  245,
-  244,
-  247,
   253,
-  262,
-  273,
-  287,
-  300,
-  314,
-  328,
-  341,
-  354,
-  366,
-  376,
-  385,
-  390,
+  247,
+  244,
+  246,
+  252,
+  263,
+  277,
+  293,
+  308,
+  325,
+  340,
+  356,
+  369,
+  381,
+  389,
   392,
   389,
-  384,
-  374,
-  361,
-  345,
-  327,
-  309,
-  290,
-  272,
-  258,
-  249,
-  245,
-  250,
-  265,
+  383,
+  370,
+  353,
+  333,
+  312,
   290,
-  326,
-  373,
-  427,
-  490,
-  556,
-  625,
-  693,
-  759,
-  820,
-  875,
-  922,
-  959,
-  985,
+  269,
+  254,
+  246,
+  247,
+  263,
+  291,
+  336,
+  393,
+  462,
+  538,
+  618,
+  698,
+  775,
+  844,
+  904,
+  951,
+  984,
+  1001,
   1000,
-  1002,
-  993,
-  974,
-  945,
-  908,
-  865,
-  818,
-  768,
-  717,
-  666,
-  616,
-  570,
+  986,
+  957,
+  916,
+  866,
+  811,
+  752,
+  692,
+  633,
+  578,
   527,
-  488,
-  452,
-  419,
-  389,
-  361,
-  333,
-  303,
-  272,
-  237,
-  199,
-  158,
-  116,
-  73,
-  33,
-  -2,
-  -31,
-  -49,
-  -56,
-  -50,
-  -30,
-  3,
-  47,
-  100,
-  161,
-  225,
-  292,
-  357,
-  420,
-  477,
-  529,
-  573,
-  610,
-  639,
+  482,
+  440,
+  403,
+  370,
+  337,
+  302,
+  265,
+  223,
+  177,
+  128,
+  78,
+  31,
+  -10,
+  -40,
+  -54,
+  -53,
+  -32,
+  7,
+  60,
+  126,
+  200,
+  277,
+  354,
+  427,
+  493,
+  551,
+  598,
+  634,
   659,
-  671,
-  675,
-  670,
-  657,
-  637,
-  608,
-  574,
-  534,
-  489,
-  441,
-  391,
-  341,
-  291,
-  244,
-  199,
-  157,
-  117,
-  79,
-  41,
-  3,
-  -38,
-  -79,
-  -123,
-  -168,
-  -214,
-  -261,
-  -309,
-  -358,
-  -405,
-  -452,
-  -498,
-  -540,
-  -580,
-  -616,
-  -648,
-  -676,
-  -699,
-  -717,
-  -731,
-  -738,
+  672,
+  674,
+  664,
+  645,
+  613,
+  573,
+  526,
+  472,
+  415,
+  356,
+  297,
+  242,
+  190,
+  141,
+  95,
+  51,
+  6,
+  -41,
+  -90,
+  -142,
+  -195,
+  -250,
+  -306,
+  -363,
+  -418,
+  -473,
+  -525,
+  -572,
+  -615,
+  -652,
+  -684,
+  -708,
+  -727,
+  -737,
   -741,
-  -738,
-  -730,
-  -719,
-  -705,
-  -690,
-  -674,
+  -737,
+  -727,
+  -712,
+  -695,
+  -676,
   -659,
-  -645,
-  -630,
-  -616,
-  -601,
-  -585,
-  -569,
-  -553,
-  -537,
-  -522,
-  -506,
-  -490,
-  -473,
-  -453,
-  -429,
-  -399,
-  -364,
-  -321,
-  -272,
-  -218,
-  -158,
-  -94,
-  -27,
-  41,
-  108,
-  173,
-  234,
-  290,
-  339,
-  380,
-  412,
-  434,
-  448,
+  -642,
+  -625,
+  -608,
+  -589,
+  -571,
+  -552,
+  -534,
+  -516,
+  -497,
+  -477,
+  -455,
+  -426,
+  -390,
+  -346,
+  -292,
+  -230,
+  -161,
+  -86,
+  -7,
+  73,
+  150,
+  223,
+  289,
+  346,
+  392,
+  424,
+  444,
   452,
   448,
-  437,
-  421,
-  402,
-  382,
-  362,
-  344,
-  328,
-  316,
-  307,
-  301,
-  298,
+  434,
+  414,
+  391,
+  368,
+  346,
+  327,
+  314,
+  304,
+  299,
   298,
-  302,
-  309,
-  319,
-  331,
-  345,
-  360,
-  373,
-  387,
-  401,
-  416,
-  433,
-  454,
-  479,
-  510,
-  546,
-  586,
-  629,
-  671,
-  711,
-  746,
-  775,
+  301,
+  310,
+  322,
+  337,
+  354,
+  370,
+  386,
+  403,
+  420,
+  442,
+  469,
+  503,
+  545,
+  592,
+  642,
+  691,
+  735,
+  771,
   796,
-  807,
-  811,
-  806,
-  793,
-  773,
-  746,
-  712,
-  673,
-  629,
-  581,
-  530,
-  478,
-  429,
-  382,
-  340,
-  304,
-  273,
-  249,
-  230,
-  214,
-  204,
-  196,
-  193,
-  196,
-  202,
-  214,
-  230,
-  249,
-  271,
-  293,
-  314,
-  333,
-  350,
+  808,
+  810,
+  800,
+  780,
+  750,
+  711,
+  664,
+  611,
+  553,
+  492,
+  434,
+  379,
+  331,
+  291,
+  258,
+  235,
+  215,
+  203,
+  194,
+  194,
+  199,
+  211,
+  229,
+  252,
+  278,
+  303,
+  326,
+  347,
   364,
+  377,
+  386,
+  391,
+  391,
+  386,
   375,
-  384,
-  389,
-  392,
-  390,
-  385,
-  375,
-  361,
-  343,
-  322,
-  298,
-  274,
-  250,
-  226,
-  202,
-  180,
-  157,
-  136,
-  114,
-  93,
-  73,
-  52,
-  33,
-  15,
-  -1,
-  -15,
-  -28,
-  -41,
-  -53,
-  -65,
-  -76,
-  -86,
-  -94,
+  358,
+  336,
+  309,
+  281,
+  253,
+  225,
+  197,
+  171,
+  145,
+  120,
+  95,
+  71,
+  47,
+  25,
+  5,
+  -12,
+  -27,
+  -42,
+  -57,
+  -70,
+  -82,
+  -93,
   -99,
   -100,
-  -98,
-  -92,
-  -82,
-  -72,
-  -61,
+  -97,
+  -87,
+  -75,
+  -63,
   -52,
-  -46,
-  -42,
-  -41,
-  -43,
   -45,
-  -48,
+  -41,
+  -42,
+  -44,
+  -47,
   -53,
-  -58,
-  -67,
-  -80,
-  -99,
-  -124,
-  -157,
-  -199,
-  -246,
-  -299,
-  -355,
-  -411,
-  -467,
-  -517,
-  -563,
-  -600,
-  -627,
-  -647,
-  -656,
-  -656,
-  -648,
-  -633,
-  -615,
-  -595,
-  -576,
-  -558,
-  -544,
+  -59,
+  -71,
+  -90,
+  -116,
+  -153,
+  -202,
+  -258,
+  -322,
+  -387,
+  -453,
+  -513,
+  -567,
+  -608,
+  -637,
+  -654,
+  -657,
+  -649,
+  -631,
+  -609,
+  -586,
+  -564,
+  -546,
   -533,
-  -523,
-  -515,
-  -507,
-  -498,
-  -488,
-  -477,
+  -522,
+  -513,
+  -503,
+  -491,
+  -479,
   -465,
-  -454,
-  -445,
-  -438,
-  -434,
+  -452,
+  -442,
+  -435,
   -433,
   -435,
   -440,
-  -448,
-  -459,
-  -474,
-  -490,
-  -507,
-  -524,
-  -537,
-  -546,
-  -547,
-  -539,
+  -450,
+  -465,
+  -483,
+  -502,
   -522,
-  -494,
-  -455,
-  -406,
-  -350,
-  -287,
-  -222,
-  -158,
-  -97,
-  -41,
-  8,
-  50,
-  85,
-  115,
-  139,
-  159,
+  -538,
+  -547,
+  -545,
+  -530,
+  -502,
+  -458,
+  -400,
+  -333,
+  -258,
+  -182,
+  -109,
+  -43,
+  14,
+  62,
+  100,
+  131,
+  156,
   175,
-  186,
-  194,
-  197,
+  188,
   196,
-  191,
-  179,
-  163,
-  140,
-  111,
-  74,
-  32,
-  -16,
-  -69,
-  -125,
-  -181,
-  -235,
-  -283,
-  -325,
-  -358,
-  -380,
-  -393,
-  -396,
-  -389,
-  -374,
-  -352,
-  -325,
-  -293,
-  -256,
-  -216,
-  -173,
-  -127,
-  -77,
-  -24,
-  32,
-  89,
-  149,
-  210,
-  272,
-  334,
-  394,
-  452,
-  507,
-  555,
-  594,
-  624,
-  642,
+  197,
+  193,
+  181,
+  162,
+  135,
+  98,
+  52,
+  -2,
+  -63,
+  -128,
+  -194,
+  -255,
+  -308,
+  -351,
+  -379,
+  -394,
+  -395,
+  -383,
+  -361,
+  -331,
+  -295,
+  -251,
+  -204,
+  -152,
+  -95,
+  -34,
+  31,
+  98,
+  169,
+  241,
+  314,
+  385,
+  453,
+  517,
+  570,
+  611,
+  638,
   648,
   642,
-  626,
-  600,
-  568,
-  533,
-  497,
-  464,
-  434,
-  410,
-  392,
-  379,
-  372,
+  621,
+  588,
+  549,
+  506,
+  467,
+  432,
+  405,
+  386,
+  374,
   370,
   372,
-  377,
-  385,
-  394,
-  404,
-  414,
-  423,
+  378,
+  387,
+  398,
+  410,
+  421,
   432,
-  442,
-  453,
-  466,
-  484,
-  506,
-  531,
+  444,
+  457,
+  474,
+  498,
+  526,
   559,
-  588,
-  615,
-  639,
-  658,
-  670,
+  593,
+  624,
+  650,
+  667,
   675,
   672,
-  662,
-  645,
-  623,
-  595,
-  563,
-  528,
-  491,
-  452,
-  412,
-  371,
-  330,
-  288,
-  244,
-  200,
-  155,
-  109,
-  65,
-  21,
-  -21,
-  -60,
-  -95,
-  -127,
-  -153,
-  -176,
-  -194,
-  -207,
+  659,
+  637,
+  608,
+  572,
+  532,
+  489,
+  443,
+  395,
+  347,
+  299,
+  247,
+  196,
+  143,
+  90,
+  38,
+  -12,
+  -58,
+  -99,
+  -135,
+  -164,
+  -188,
+  -205,
   -219,
-  -228,
-  -237,
-  -246,
-  -255,
-  -266,
-  -280,
+  -229,
+  -240,
+  -250,
+  -262,
+  -278,
   -298,
-  -319,
-  -345,
-  -376,
-  -410,
-  -449,
-  -490,
-  -534,
-  -578,
-  -621,
-  -662,
-  -700,
-  -734,
-  -765,
-  -792,
-  -815,
-  -837,
-  -858,
-  -878,
-  -899,
-  -920,
-  -942,
-  -963,
-  -983,
-  -1000,
-  -1013,
-  -1021,
+  -323,
+  -356,
+  -394,
+  -437,
+  -485,
+  -536,
+  -588,
+  -637,
+  -684,
+  -725,
+  -762,
+  -794,
+  -821,
+  -846,
+  -870,
+  -894,
+  -919,
+  -944,
+  -969,
+  -991,
+  -1009,
+  -1020,
   -1024,
-  -1019,
-  -1005,
-  -981,
-  -948,
-  -904,
-  -850,
+  -1018,
+  -999,
+  -966,
+  -920,
+  -860,
   -789,
-  -720,
-  -649,
-  -578,
-  -507,
-  -442,
-  -382,
-  -330,
-  -286,
-  -251,
-  -227,
-  -213,
-  -211,
-  -219,
-  -238,
-  -265,
-  -300,
-  -343,
+  -708,
+  -625,
+  -541,
+  -462,
   -390,
-  -441,
-  -494,
-  -548,
-  -601,
-  -651,
-  -696,
-  -735,
-  -765,
-  -788,
-  -802,
-  -809,
+  -328,
+  -278,
+  -241,
+  -218,
+  -210,
+  -218,
+  -239,
+  -273,
+  -317,
+  -370,
+  -428,
+  -490,
+  -553,
+  -615,
+  -671,
+  -721,
+  -759,
+  -787,
+  -803,
   -810,
-  -807,
-  -801,
-  -793,
+  -809,
+  -804,
+  -795,
   -784,
-  -774,
-  -765,
-  -757,
-  -748,
-  -741,
-  -733,
+  -772,
+  -763,
+  -752,
+  -743,
+  -734,
   -725,
-  -716,
-  -705,
-  -692,
-  -676,
-  -656,
-  -634,
-  -609,
-  -580,
-  -549,
-  -516,
-  -479,
-  -441,
-  -400,
-  -358,
-  -315,
-  -272,
-  -232,
-  -194,
-  -161,
-  -135,
-  -115,
-  -104,
-  -98,
-  -98,
+  -714,
+  -701,
+  -684,
+  -662,
+  -637,
+  -608,
+  -573,
+  -537,
+  -495,
+  -451,
+  -404,
+  -355,
+  -304,
+  -255,
+  -209,
+  -168,
+  -136,
+  -114,
   -102,
-  -108,
+  -97,
+  -100,
+  -107,
   -112,
   -112,
-  -108,
-  -96,
-  -79,
-  -53,
-  -22
+  -105,
+  -88,
+  -63,
+  -27
 };
@@ -19,604 +19,516 @@
 #include <avr/pgmspace.h>
 #include "waveforms.h"
 const int16_t saw_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
-  0,
-  1024,
-  879,
-  972,
-  898,
-  946,
-  906,
-  926,
+  101,
+  990,
   909,
+  944,
+  916,
+  929,
   911,
-  906,
-  901,
-  900,
-  894,
-  892,
-  886,
-  886,
+  918,
+  904,
+  907,
+  897,
+  898,
+  888,
+  888,
   883,
-  879,
+  882,
   875,
-  872,
-  868,
+  873,
+  867,
   864,
-  861,
-  857,
-  854,
+  858,
+  856,
   850,
-  846,
-  843,
-  839,
-  836,
-  832,
-  828,
+  847,
+  842,
+  838,
+  834,
+  829,
   825,
   821,
-  818,
-  814,
-  810,
-  807,
-  803,
+  817,
+  813,
+  809,
+  804,
   800,
   796,
   792,
-  789,
-  785,
-  782,
-  778,
+  787,
+  783,
+  779,
   775,
   771,
-  767,
-  764,
-  760,
-  757,
-  753,
+  766,
+  762,
+  758,
+  754,
   750,
   746,
-  743,
-  739,
-  736,
-  732,
+  742,
+  738,
+  734,
   729,
-  725,
-  722,
+  726,
+  721,
   718,
-  715,
-  711,
-  708,
-  704,
+  713,
+  709,
+  705,
   701,
-  697,
-  694,
-  690,
-  687,
-  683,
+  696,
+  693,
+  688,
+  685,
   680,
-  676,
-  673,
-  669,
-  666,
-  662,
-  659,
+  677,
+  672,
+  668,
+  664,
+  660,
   655,
   652,
-  648,
-  645,
-  642,
-  638,
-  635,
+  647,
+  644,
+  639,
+  636,
   631,
   628,
-  624,
-  621,
-  617,
-  614,
-  611,
+  623,
+  620,
+  615,
+  612,
   607,
   604,
-  600,
-  597,
-  594,
-  590,
-  587,
+  599,
+  596,
+  591,
+  588,
   583,
   580,
-  577,
-  573,
-  570,
-  566,
-  563,
+  575,
+  572,
+  567,
+  564,
   560,
   556,
-  553,
-  549,
-  546,
-  543,
-  539,
+  551,
+  548,
+  544,
+  540,
   536,
   533,
-  529,
-  526,
-  523,
-  519,
-  516,
-  513,
+  527,
+  525,
+  520,
+  517,
+  512,
   509,
-  506,
-  503,
-  499,
+  505,
+  501,
   496,
-  493,
-  489,
+  494,
+  488,
   486,
-  483,
-  479,
-  476,
+  481,
+  478,
   473,
-  469,
-  466,
+  470,
+  465,
   463,
-  460,
-  456,
-  453,
+  458,
+  454,
   450,
-  446,
-  443,
+  447,
+  442,
   440,
-  437,
-  433,
-  430,
+  435,
+  431,
   427,
-  423,
-  420,
+  424,
+  419,
   417,
-  414,
-  410,
-  407,
+  411,
+  408,
   404,
   401,
-  397,
-  394,
-  391,
-  388,
-  384,
+  396,
+  393,
+  389,
+  386,
   381,
   378,
-  375,
-  372,
-  368,
-  365,
-  362,
+  374,
+  371,
+  366,
+  363,
   359,
   355,
-  352,
-  349,
-  346,
-  343,
-  339,
-  336,
+  351,
+  348,
+  344,
+  340,
+  335,
   333,
-  330,
-  327,
-  324,
-  320,
-  317,
+  328,
+  326,
+  321,
+  318,
   314,
   311,
-  308,
-  305,
-  301,
+  307,
+  304,
   298,
-  295,
-  292,
+  296,
+  291,
   289,
-  286,
-  282,
-  279,
+  284,
+  281,
   276,
-  273,
-  270,
+  274,
+  269,
   267,
-  264,
-  260,
-  257,
+  262,
+  259,
   254,
-  251,
-  248,
+  252,
+  247,
   245,
-  242,
-  239,
-  236,
+  240,
+  238,
   232,
-  229,
-  226,
+  230,
+  225,
   223,
-  220,
-  217,
-  214,
+  218,
+  216,
   211,
-  208,
-  205,
+  209,
+  204,
   201,
-  198,
-  195,
-  192,
+  196,
+  194,
   189,
-  186,
-  183,
+  187,
+  182,
   180,
-  177,
-  174,
-  171,
+  175,
+  173,
   168,
   165,
-  162,
-  159,
-  156,
-  153,
-  150,
+  161,
+  158,
+  154,
+  151,
   146,
   143,
-  140,
-  137,
-  134,
-  131,
-  128,
+  139,
+  136,
+  132,
+  129,
   125,
   122,
-  119,
-  116,
-  113,
-  110,
-  107,
+  118,
+  115,
+  111,
+  108,
   104,
   101,
-  98,
-  95,
-  92,
+  97,
+  94,
   89,
-  86,
-  83,
+  87,
+  82,
   80,
-  77,
-  74,
-  71,
+  75,
+  73,
   68,
-  65,
-  63,
+  66,
+  62,
   60,
-  57,
-  54,
-  51,
+  55,
+  53,
   48,
-  45,
-  42,
+  46,
+  41,
   39,
-  36,
-  33,
-  30,
+  34,
+  32,
   27,
-  24,
-  21,
+  25,
+  20,
   18,
-  15,
-  12,
-  10,
+  13,
+  11,
   7,
-  4,
-  1,
+  5,
+  0,
   -2,
-  -5,
-  -8,
-  -11,
+  -7,
+  -9,
   -14,
-  -17,
-  -19,
+  -16,
+  -20,
   -22,
-  -25,
-  -28,
-  -31,
+  -27,
+  -29,
   -34,
-  -37,
-  -40,
+  -36,
+  -41,
   -43,
-  -45,
-  -48,
-  -51,
+  -47,
+  -49,
   -54,
-  -57,
-  -60,
+  -56,
+  -61,
   -63,
-  -65,
-  -68,
-  -71,
+  -67,
+  -70,
   -74,
   -77,
-  -80,
+  -81,
   -83,
-  -85,
-  -88,
-  -91,
+  -87,
+  -90,
   -94,
   -97,
-  -100,
-  -102,
-  -105,
-  -108,
-  -111,
+  -101,
+  -103,
+  -107,
+  -110,
   -114,
   -116,
-  -119,
-  -122,
-  -125,
+  -121,
+  -123,
   -128,
-  -131,
-  -133,
+  -130,
+  -134,
   -136,
-  -139,
-  -142,
-  -145,
+  -141,
+  -143,
   -147,
-  -150,
-  -153,
+  -149,
+  -154,
   -156,
-  -158,
-  -161,
-  -164,
+  -160,
+  -162,
   -167,
-  -170,
-  -172,
+  -169,
+  -173,
   -175,
-  -178,
-  -181,
-  -183,
+  -180,
+  -182,
   -186,
-  -189,
-  -192,
+  -188,
+  -193,
   -194,
-  -197,
-  -200,
-  -203,
+  -199,
+  -201,
   -205,
-  -208,
-  -211,
+  -207,
+  -212,
   -214,
-  -216,
-  -219,
-  -222,
+  -218,
+  -220,
   -224,
-  -227,
-  -230,
+  -226,
+  -231,
   -233,
-  -235,
-  -238,
-  -241,
+  -237,
+  -239,
   -243,
-  -246,
-  -249,
+  -245,
+  -250,
   -252,
-  -254,
-  -257,
-  -260,
+  -256,
+  -259,
   -262,
-  -265,
-  -268,
+  -264,
+  -269,
   -270,
-  -273,
-  -276,
-  -278,
+  -275,
+  -277,
   -281,
-  -284,
-  -286,
-  -289,
-  -292,
-  -295,
-  -297,
+  -283,
+  -287,
+  -290,
+  -294,
+  -296,
   -300,
   -302,
-  -305,
+  -306,
   -308,
-  -310,
-  -313,
-  -316,
-  -318,
+  -312,
+  -315,
+  -319,
   -321,
-  -324,
-  -326,
-  -329,
+  -325,
+  -327,
   -332,
-  -334,
-  -337,
+  -333,
+  -338,
   -339,
-  -342,
+  -344,
   -345,
-  -347,
   -350,
-  -353,
-  -355,
+  -352,
+  -356,
   -358,
-  -360,
-  -363,
-  -366,
+  -362,
+  -364,
   -368,
-  -371,
-  -373,
+  -370,
+  -374,
   -376,
-  -379,
-  -381,
-  -384,
+  -380,
+  -382,
   -386,
-  -389,
-  -392,
+  -388,
+  -393,
   -394,
-  -397,
-  -399,
-  -402,
+  -398,
+  -400,
   -404,
-  -407,
-  -410,
+  -406,
+  -411,
   -412,
-  -415,
   -417,
-  -420,
+  -418,
   -422,
-  -425,
-  -428,
+  -424,
+  -429,
   -430,
-  -433,
   -435,
-  -438,
-  -440,
-  -443,
-  -445,
+  -436,
+  -441,
+  -442,
+  -446,
   -448,
-  -450,
-  -453,
-  -456,
-  -458,
-  -461,
-  -463,
+  -452,
+  -454,
+  -459,
+  -460,
+  -464,
   -466,
-  -468,
-  -471,
-  -473,
+  -470,
+  -472,
   -476,
   -478,
-  -481,
-  -483,
-  -486,
+  -482,
+  -484,
   -488,
-  -491,
-  -493,
-  -496,
-  -498,
+  -489,
+  -494,
+  -495,
+  -500,
   -501,
-  -503,
   -506,
-  -508,
+  -507,
   -511,
   -513,
-  -516,
-  -518,
-  -521,
+  -517,
+  -519,
   -523,
-  -526,
-  -528,
+  -525,
+  -529,
   -530,
-  -533,
-  -535,
-  -538,
+  -534,
+  -536,
   -540,
-  -543,
-  -545,
-  -548,
-  -550,
+  -541,
+  -546,
+  -547,
+  -552,
   -553,
-  -555,
   -558,
-  -560,
-  -562,
+  -559,
+  -563,
   -565,
-  -567,
+  -569,
   -570,
-  -572,
   -575,
-  -577,
-  -579,
+  -576,
+  -580,
   -582,
-  -584,
+  -586,
   -587,
-  -589,
   -592,
-  -594,
-  -596,
+  -593,
+  -597,
   -599,
-  -601,
-  -604,
-  -606,
+  -603,
+  -605,
   -608,
-  -611,
-  -613,
+  -610,
+  -614,
   -616,
-  -618,
   -620,
-  -623,
+  -621,
   -625,
-  -628,
-  -630,
+  -627,
+  -631,
   -632,
-  -635,
   -637,
-  -639,
+  -637,
   -642,
-  -644,
-  -647,
+  -643,
+  -648,
   -649,
-  -651,
-  -654,
-  -656,
-  -658,
-  -661,
-  -663,
+  -653,
+  -655,
+  -659,
+  -660,
+  -665,
   -666,
-  -668,
   -670,
-  -673,
-  -675,
-  -677,
-  -680,
+  -671,
+  -676,
+  -676,
+  -682,
   -682,
-  -684,
   -687,
-  -689,
-  -691,
-  -694,
-  -696,
-  -698,
-  -701,
+  -688,
+  -692,
+  -693,
+  -697,
+  -699,
   -703,
-  -705,
-  -708,
-  -710,
-  -712,
+  -704,
+  -709,
+  -709,
+  -714,
   -715,
-  -717,
   -719,
-  -721,
-  -724,
-  -726,
-  -728,
+  -720,
+  -725,
+  -725,
+  -730,
   -731,
-  -733,
   -735,
-  -738,
-  -740,
+  -737,
+  -741,
   -742,
-  -744,
-  -747,
-  -749,
+  -746,
+  -748,
   -751,
-  -754,
-  -756,
+  -753,
+  -757,
   -758,
-  -760,
+  -762,
   -763,
-  -764,
-  -768,
+  -767,
   -769,
-  -773,
-  -773,
-  -777,
-  -780,
-  -776,
-  -792,
-  -771,
-  -810,
-  -759,
-  -834,
-  -737,
-  -887,
-  -511
+  -772,
+  -774,
+  -778,
+  -779,
+  -783,
+  -786,
+  -787,
+  -793,
+  -786,
+  -817,
+  -667
 };
@@ -19,147 +19,126 @@
 #include <avr/pgmspace.h>
 #include "waveforms.h"
 const int16_t sin_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
-  9,
-  19,
-  30,
-  41,
-  51,
-  62,
-  73,
+  8,
+  21,
+  34,
+  46,
+  58,
+  72,
   83,
-  94,
-  105,
-  115,
-  126,
-  137,
-  147,
-  158,
-  168,
-  179,
-  190,
-  200,
-  211,
-  221,
-  231,
-  242,
-  252,
-  263,
-  273,
-  283,
+  96,
+  109,
+  121,
+  134,
+  146,
+  159,
+  170,
+  184,
+  196,
+  208,
+  220,
+  232,
+  245,
+  257,
+  269,
+  281,
   294,
-  304,
-  314,
-  324,
-  334,
-  344,
-  355,
+  305,
+  317,
+  329,
+  340,
+  353,
   365,
-  375,
-  384,
-  394,
-  404,
-  414,
-  424,
+  376,
+  387,
+  399,
+  411,
+  422,
   434,
-  443,
-  453,
-  462,
-  472,
-  481,
-  491,
-  500,
-  510,
-  519,
-  528,
-  537,
-  546,
-  555,
-  564,
-  573,
-  582,
-  591,
-  600,
-  608,
-  617,
-  625,
-  634,
-  642,
-  650,
-  659,
-  667,
+  445,
+  456,
+  467,
+  478,
+  490,
+  501,
+  512,
+  523,
+  533,
+  544,
+  554,
+  565,
+  575,
+  586,
+  596,
+  606,
+  616,
+  626,
+  636,
+  646,
+  656,
+  666,
   675,
-  683,
-  691,
-  699,
-  707,
-  714,
-  722,
+  684,
+  693,
+  703,
+  712,
+  721,
   729,
-  737,
-  744,
-  752,
-  759,
-  766,
-  773,
+  738,
+  747,
+  756,
+  764,
+  772,
   780,
-  787,
-  794,
-  801,
-  807,
-  814,
+  788,
+  797,
+  804,
+  812,
   820,
   827,
-  833,
-  839,
-  845,
-  851,
-  857,
+  835,
+  841,
+  849,
+  855,
   863,
   869,
-  874,
-  880,
-  885,
-  890,
-  896,
+  876,
+  882,
+  888,
+  895,
   901,
   906,
-  911,
-  916,
-  920,
-  925,
-  930,
+  913,
+  918,
+  923,
+  929,
   934,
-  938,
-  943,
-  947,
-  951,
-  955,
-  959,
+  939,
+  944,
+  949,
+  954,
+  958,
   962,
   966,
-  969,
-  973,
-  976,
-  979,
+  971,
+  975,
+  978,
   982,
   985,
-  988,
-  991,
-  994,
-  996,
-  999,
+  989,
+  992,
+  995,
+  998,
   1001,
   1003,
-  1005,
-  1007,
-  1009,
-  1011,
+  1006,
+  1008,
+  1010,
   1012,
   1014,
   1015,
   1017,
   1018,
-  1019,
   1020,
   1021,
   1022,
@@ -172,293 +151,249 @@ const int16_t sin_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   1023,
   1023,
   1023,
-  1023,
-  1023,
   1022,
   1022,
   1021,
   1020,
   1019,
-  1018,
-  1016,
+  1017,
   1015,
   1014,
   1012,
   1010,
-  1009,
-  1007,
-  1005,
-  1002,
+  1008,
+  1006,
+  1003,
   1000,
   998,
-  995,
-  993,
-  990,
-  987,
+  994,
+  992,
+  988,
   985,
   982,
   978,
-  975,
-  972,
-  968,
-  965,
-  961,
+  974,
+  970,
+  966,
+  962,
   958,
   954,
-  950,
-  946,
-  942,
-  937,
-  933,
+  949,
+  944,
+  939,
+  934,
   928,
-  924,
-  919,
-  914,
-  910,
-  905,
-  900,
+  923,
+  917,
+  912,
+  907,
+  901,
   894,
-  889,
-  884,
-  878,
-  873,
-  867,
+  888,
+  882,
+  875,
+  869,
   861,
   855,
-  850,
-  844,
-  837,
-  831,
-  825,
+  849,
+  841,
+  833,
+  826,
   819,
-  812,
-  805,
-  799,
-  792,
-  785,
-  778,
+  811,
+  803,
+  796,
+  788,
+  780,
   771,
-  764,
-  757,
-  750,
-  742,
-  735,
-  728,
+  763,
+  755,
+  746,
+  737,
+  729,
   720,
-  712,
-  705,
-  697,
-  689,
-  681,
-  673,
+  711,
+  702,
+  693,
+  683,
+  674,
   665,
-  657,
-  648,
-  640,
-  632,
-  623,
-  615,
-  606,
-  597,
-  589,
-  580,
-  571,
-  562,
-  553,
-  544,
-  535,
-  526,
-  516,
-  507,
-  498,
-  488,
-  479,
-  470,
-  460,
-  450,
-  441,
-  431,
+  655,
+  645,
+  636,
+  625,
+  616,
+  605,
+  595,
+  585,
+  575,
+  564,
+  554,
+  543,
+  533,
+  522,
+  510,
+  500,
+  489,
+  478,
+  467,
+  455,
+  444,
+  433,
   421,
-  412,
-  402,
-  392,
-  382,
-  372,
-  362,
+  410,
+  399,
+  387,
+  375,
+  364,
   352,
-  342,
-  332,
-  322,
-  311,
-  301,
-  291,
-  281,
-  270,
-  260,
-  250,
-  239,
-  229,
-  218,
-  208,
-  197,
-  187,
-  176,
-  166,
-  155,
+  340,
+  329,
+  316,
+  304,
+  292,
+  280,
+  268,
+  256,
+  244,
+  232,
+  219,
+  207,
+  195,
+  182,
+  170,
+  158,
   145,
-  134,
-  123,
-  113,
-  102,
-  91,
-  81,
+  133,
+  120,
+  108,
+  95,
+  83,
   70,
-  59,
-  49,
-  38,
-  27,
-  16,
-  6,
+  58,
+  46,
+  33,
+  20,
+  8,
   -5,
-  -16,
-  -26,
-  -37,
-  -48,
-  -58,
-  -69,
+  -18,
+  -30,
+  -43,
+  -55,
+  -67,
   -80,
-  -90,
-  -101,
-  -112,
-  -122,
-  -133,
-  -144,
-  -154,
-  -165,
-  -175,
-  -186,
-  -196,
-  -207,
-  -217,
-  -228,
-  -238,
-  -249,
-  -259,
-  -269,
-  -280,
+  -92,
+  -105,
+  -117,
+  -130,
+  -143,
+  -155,
+  -167,
+  -180,
+  -192,
+  -204,
+  -216,
+  -229,
+  -241,
+  -254,
+  -265,
+  -278,
   -290,
-  -300,
-  -311,
-  -321,
-  -331,
-  -341,
-  -351,
+  -301,
+  -314,
+  -326,
+  -337,
+  -349,
   -361,
-  -371,
-  -381,
-  -391,
-  -401,
-  -411,
-  -421,
+  -373,
+  -384,
+  -396,
+  -408,
+  -420,
   -430,
-  -440,
-  -450,
-  -459,
-  -469,
-  -478,
-  -488,
+  -442,
+  -453,
+  -464,
+  -475,
+  -487,
   -497,
-  -506,
-  -516,
-  -525,
-  -534,
-  -543,
-  -552,
-  -561,
-  -570,
-  -579,
-  -588,
-  -597,
-  -605,
-  -614,
-  -622,
-  -631,
-  -639,
-  -648,
-  -656,
-  -664,
+  -508,
+  -520,
+  -530,
+  -541,
+  -551,
+  -562,
+  -572,
+  -583,
+  -593,
+  -603,
+  -613,
+  -623,
+  -633,
+  -643,
+  -653,
+  -662,
   -672,
-  -680,
-  -688,
-  -696,
-  -704,
-  -712,
-  -719,
+  -681,
+  -691,
+  -700,
+  -709,
+  -718,
   -727,
-  -734,
-  -742,
-  -749,
-  -756,
-  -764,
-  -771,
+  -735,
+  -745,
+  -752,
+  -761,
+  -770,
   -778,
-  -785,
-  -791,
-  -798,
-  -805,
-  -811,
-  -818,
+  -786,
+  -793,
+  -802,
+  -809,
+  -817,
   -824,
-  -831,
-  -837,
-  -843,
-  -849,
-  -855,
+  -832,
+  -839,
+  -847,
+  -853,
   -861,
   -867,
-  -872,
-  -878,
-  -883,
-  -889,
-  -894,
+  -874,
+  -880,
+  -887,
+  -893,
   -899,
-  -904,
-  -909,
-  -914,
-  -919,
-  -923,
-  -928,
+  -905,
+  -910,
+  -916,
+  -922,
+  -927,
   -933,
-  -937,
-  -941,
-  -945,
-  -949,
-  -953,
-  -957,
+  -938,
+  -942,
+  -947,
+  -952,
+  -956,
   -961,
   -965,
-  -968,
-  -972,
-  -975,
-  -978,
+  -969,
+  -974,
+  -977,
   -981,
   -984,
-  -987,
-  -990,
-  -993,
-  -995,
-  -998,
+  -988,
+  -991,
+  -994,
+  -997,
   -1000,
   -1002,
-  -1004,
-  -1006,
-  -1008,
-  -1010,
+  -1005,
+  -1007,
+  -1009,
   -1012,
   -1013,
   -1015,
-  -1016,
-  -1018,
+  -1017,
   -1019,
   -1020,
   -1021,
@@ -471,152 +406,129 @@ const int16_t sin_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   -1024,
   -1024,
   -1024,
-  -1024,
-  -1023,
   -1023,
   -1022,
   -1022,
   -1021,
   -1020,
   -1019,
-  -1018,
   -1017,
   -1016,
   -1014,
   -1013,
   -1011,
-  -1009,
-  -1007,
-  -1005,
-  -1003,
+  -1008,
+  -1006,
+  -1004,
   -1001,
   -999,
-  -996,
-  -994,
-  -991,
-  -988,
-  -985,
+  -995,
+  -993,
+  -989,
+  -986,
   -983,
   -979,
-  -976,
-  -973,
-  -970,
-  -966,
-  -963,
+  -975,
+  -972,
+  -967,
+  -964,
   -959,
-  -955,
-  -951,
-  -947,
-  -943,
-  -939,
-  -934,
+  -954,
+  -950,
+  -945,
+  -940,
+  -935,
   -930,
-  -925,
-  -921,
-  -916,
-  -911,
-  -906,
-  -901,
+  -924,
+  -919,
+  -913,
+  -907,
+  -902,
   -896,
-  -891,
-  -886,
-  -880,
-  -875,
-  -869,
+  -890,
+  -884,
+  -877,
+  -871,
   -863,
   -857,
-  -852,
-  -846,
-  -839,
-  -833,
-  -827,
+  -851,
+  -843,
+  -835,
+  -829,
   -821,
-  -814,
-  -808,
-  -801,
-  -794,
-  -787,
-  -781,
+  -813,
+  -806,
+  -798,
+  -790,
+  -782,
   -774,
-  -767,
-  -759,
-  -752,
-  -745,
-  -737,
-  -730,
+  -766,
+  -757,
+  -749,
+  -740,
+  -731,
   -722,
-  -715,
-  -707,
-  -699,
-  -691,
-  -684,
-  -676,
+  -714,
+  -704,
+  -695,
+  -686,
+  -677,
   -667,
-  -659,
-  -651,
-  -643,
-  -634,
-  -626,
-  -617,
-  -609,
-  -600,
-  -591,
-  -583,
-  -574,
-  -565,
-  -556,
-  -547,
-  -538,
-  -529,
-  -520,
-  -510,
-  -501,
+  -657,
+  -648,
+  -638,
+  -628,
+  -618,
+  -608,
+  -598,
+  -588,
+  -578,
+  -567,
+  -557,
+  -546,
+  -536,
+  -525,
+  -514,
+  -503,
   -492,
-  -482,
-  -473,
-  -463,
-  -454,
-  -444,
-  -434,
+  -481,
+  -470,
+  -459,
+  -448,
+  -436,
   -425,
-  -415,
-  -405,
-  -395,
-  -385,
-  -375,
-  -365,
+  -413,
+  -402,
+  -390,
+  -378,
+  -366,
   -355,
-  -345,
-  -335,
-  -325,
-  -315,
-  -305,
-  -294,
+  -343,
+  -332,
+  -320,
+  -308,
+  -295,
   -284,
-  -274,
-  -263,
-  -253,
-  -243,
-  -232,
-  -222,
-  -211,
-  -201,
-  -190,
-  -180,
-  -169,
-  -159,
-  -148,
-  -137,
-  -127,
-  -116,
-  -106,
-  -95,
-  -84,
+  -272,
+  -259,
+  -247,
+  -235,
+  -223,
+  -210,
+  -198,
+  -186,
+  -173,
+  -161,
+  -149,
+  -136,
+  -124,
+  -111,
+  -99,
+  -86,
   -74,
-  -63,
-  -52,
-  -41,
-  -31,
-  -20,
-  -9
+  -62,
+  -48,
+  -36,
+  -24,
+  -11
 };
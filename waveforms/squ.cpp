@@ -21,602 +21,514 @@
 const int16_t squ[N_WAVEFORM_SAMPLES] PROGMEM = {
   0,
   1023,
+  993,
   1023,
+  1007,
   1023,
+  1012,
   1023,
+  1015,
   1023,
+  1016,
   1023,
+  1018,
   1023,
+  1018,
   1023,
+  1019,
   1023,
+  1019,
   1023,
+  1020,
   1023,
+  1020,
   1023,
+  1020,
   1023,
+  1020,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1022,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1021,
   1023,
+  1020,
   1023,
+  1020,
   1023,
+  1020,
   1023,
+  1020,
   1023,
+  1019,
   1023,
+  1019,
   1023,
+  1018,
   1023,
+  1018,
   1023,
+  1016,
   1023,
+  1015,
   1023,
+  1012,
   1023,
+  1007,
   1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
-  1023,
+  993,
   1023,
   0,
   -1024,
+  -994,
   -1024,
+  -1008,
   -1024,
+  -1013,
   -1024,
+  -1016,
   -1024,
+  -1017,
   -1024,
+  -1019,
   -1024,
+  -1019,
   -1024,
+  -1020,
   -1024,
+  -1020,
   -1024,
+  -1021,
   -1024,
+  -1021,
   -1024,
+  -1021,
   -1024,
+  -1021,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1023,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1022,
   -1024,
+  -1021,
   -1024,
+  -1021,
   -1024,
+  -1021,
   -1024,
+  -1021,
   -1024,
+  -1020,
   -1024,
+  -1020,
   -1024,
+  -1019,
   -1024,
+  -1019,
   -1024,
+  -1017,
   -1024,
+  -1016,
   -1024,
+  -1013,
   -1024,
+  -1008,
   -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
-  -1024,
+  -994,
   -1024
 };
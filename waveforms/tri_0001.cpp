@@ -20,603 +20,515 @@
 #include "waveforms.h"
 const int16_t tri_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   0,
-  9,
-  17,
-  26,
-  34,
-  43,
-  51,
+  10,
+  20,
+  30,
+  40,
+  50,
   60,
-  68,
-  76,
-  84,
-  92,
-  101,
-  109,
+  70,
+  79,
+  88,
+  98,
+  108,
   117,
-  125,
-  133,
-  140,
-  148,
-  156,
-  164,
-  171,
-  179,
-  187,
-  194,
-  202,
-  209,
-  217,
-  224,
-  232,
-  239,
-  246,
-  253,
-  261,
+  127,
+  136,
+  145,
+  154,
+  163,
+  172,
+  181,
+  190,
+  199,
+  208,
+  216,
+  225,
+  234,
+  242,
+  250,
+  259,
   268,
-  275,
-  282,
-  289,
-  296,
-  303,
-  310,
+  276,
+  284,
+  292,
+  301,
+  309,
   317,
-  324,
-  330,
-  337,
-  344,
-  351,
-  357,
+  325,
+  332,
+  341,
+  349,
+  356,
   364,
-  370,
-  377,
-  383,
-  390,
-  396,
-  403,
+  372,
+  379,
+  387,
+  394,
+  402,
   409,
-  415,
-  422,
-  428,
-  434,
-  440,
+  417,
+  425,
+  431,
+  439,
   446,
-  452,
-  458,
-  464,
-  470,
-  476,
-  482,
+  453,
+  460,
+  467,
+  474,
+  481,
   488,
-  494,
-  500,
-  505,
-  511,
-  517,
-  522,
+  495,
+  502,
+  508,
+  515,
+  521,
   528,
-  534,
-  539,
-  545,
-  550,
-  556,
-  561,
+  535,
+  541,
+  548,
+  554,
+  560,
   566,
-  572,
-  577,
-  582,
-  588,
-  593,
-  598,
+  573,
+  579,
+  585,
+  592,
+  597,
   603,
-  608,
-  613,
-  618,
-  623,
-  628,
+  609,
+  615,
+  621,
+  627,
   633,
   638,
-  643,
-  648,
-  653,
-  658,
-  663,
+  644,
+  650,
+  656,
+  662,
   667,
-  672,
-  677,
-  681,
-  686,
-  691,
-  695,
+  673,
+  678,
+  683,
+  689,
+  694,
   700,
-  704,
-  709,
-  713,
-  718,
-  722,
-  726,
+  705,
+  710,
+  715,
+  721,
+  725,
   731,
-  735,
-  739,
-  743,
-  748,
-  752,
-  756,
+  736,
+  740,
+  746,
+  751,
+  755,
   760,
-  764,
-  768,
-  772,
-  776,
-  781,
+  765,
+  770,
+  774,
+  780,
   784,
   788,
-  792,
-  796,
-  800,
-  804,
-  808,
+  793,
+  798,
+  802,
+  807,
   812,
   815,
-  819,
-  823,
-  826,
-  830,
-  834,
+  820,
+  824,
+  828,
+  833,
   837,
-  841,
-  845,
-  848,
-  852,
-  855,
-  859,
+  842,
+  846,
+  850,
+  854,
+  858,
   862,
-  865,
-  869,
-  872,
-  875,
-  879,
+  866,
+  870,
+  873,
+  878,
   882,
   885,
-  889,
-  892,
-  895,
-  898,
-  901,
+  890,
+  893,
+  897,
+  900,
   904,
   908,
-  911,
-  914,
-  917,
-  920,
-  923,
+  912,
+  915,
+  919,
+  922,
   926,
   929,
-  932,
-  935,
-  937,
-  940,
-  943,
+  933,
+  936,
+  939,
+  942,
   946,
   949,
-  952,
-  954,
-  957,
-  960,
+  953,
+  955,
+  959,
   962,
   965,
   968,
-  970,
-  973,
-  976,
-  978,
-  981,
+  971,
+  975,
+  977,
+  980,
   983,
   986,
-  988,
-  991,
-  993,
-  996,
+  989,
+  992,
+  995,
   998,
   1000,
-  1003,
-  1005,
-  1007,
-  1010,
+  1004,
+  1006,
+  1009,
   1012,
   1014,
   1016,
   1019,
-  1021,
-  1024,
-  1020,
-  1006,
-  992,
-  978,
-  965,
-  951,
-  937,
-  924,
-  911,
+  1022,
+  1023,
+  1010,
+  993,
+  977,
+  961,
+  945,
+  929,
+  914,
   897,
-  884,
-  871,
-  858,
-  845,
-  832,
-  819,
+  882,
+  867,
+  852,
+  836,
+  821,
   806,
-  793,
-  780,
-  768,
-  755,
-  742,
-  730,
+  791,
+  776,
+  761,
+  746,
+  732,
   718,
-  705,
-  693,
-  681,
-  669,
-  656,
-  644,
-  632,
-  620,
-  609,
-  597,
-  585,
-  573,
-  562,
-  550,
-  539,
-  527,
-  516,
-  505,
-  493,
+  703,
+  688,
+  675,
+  660,
+  645,
+  631,
+  617,
+  604,
+  590,
+  576,
+  563,
+  549,
+  536,
+  522,
+  509,
+  496,
   482,
-  471,
-  460,
-  449,
-  438,
-  427,
-  416,
+  470,
+  457,
+  444,
+  431,
+  418,
   405,
-  395,
-  384,
-  373,
-  363,
-  352,
-  342,
+  393,
+  380,
+  368,
+  356,
+  344,
   331,
-  321,
-  311,
-  300,
-  290,
-  280,
-  270,
+  319,
+  307,
+  295,
+  283,
+  271,
   260,
-  250,
-  240,
-  230,
-  220,
-  211,
-  201,
-  191,
-  182,
-  172,
-  163,
-  153,
-  144,
-  134,
-  125,
-  116,
-  107,
-  97,
-  88,
-  79,
+  248,
+  236,
+  224,
+  213,
+  202,
+  190,
+  179,
+  168,
+  157,
+  146,
+  135,
+  124,
+  114,
+  102,
+  91,
+  81,
   70,
-  61,
-  52,
-  44,
-  35,
-  26,
-  17,
+  60,
+  50,
+  40,
+  29,
+  18,
   9,
-  0,
-  -9,
-  -17,
-  -26,
-  -34,
-  -42,
+  -2,
+  -12,
+  -22,
+  -32,
+  -41,
   -51,
-  -59,
-  -67,
-  -75,
-  -84,
-  -92,
-  -100,
-  -108,
-  -116,
-  -124,
-  -132,
-  -139,
-  -147,
-  -155,
-  -163,
-  -170,
-  -178,
-  -186,
-  -193,
-  -201,
+  -61,
+  -70,
+  -80,
+  -90,
+  -99,
+  -109,
+  -118,
+  -127,
+  -136,
+  -145,
+  -154,
+  -164,
+  -172,
+  -182,
+  -190,
+  -199,
   -208,
-  -215,
-  -223,
-  -230,
-  -237,
-  -245,
-  -252,
+  -216,
+  -225,
+  -233,
+  -242,
+  -251,
   -259,
-  -266,
-  -273,
-  -280,
-  -287,
-  -294,
-  -301,
+  -267,
+  -275,
+  -283,
+  -292,
+  -300,
   -308,
-  -315,
-  -322,
-  -329,
-  -335,
-  -342,
-  -349,
+  -316,
+  -325,
+  -332,
+  -340,
+  -348,
   -355,
-  -362,
-  -368,
-  -375,
-  -381,
-  -388,
+  -363,
+  -371,
+  -378,
+  -386,
   -394,
-  -400,
-  -407,
-  -413,
-  -419,
-  -425,
-  -431,
+  -401,
+  -409,
+  -415,
+  -423,
+  -430,
   -438,
-  -444,
-  -450,
-  -456,
-  -462,
-  -468,
-  -474,
+  -445,
+  -452,
+  -459,
+  -466,
+  -473,
   -479,
-  -485,
-  -491,
-  -497,
-  -503,
-  -508,
-  -514,
+  -486,
+  -493,
+  -500,
+  -506,
+  -513,
   -519,
-  -525,
-  -531,
-  -536,
-  -542,
-  -547,
-  -553,
+  -526,
+  -533,
+  -539,
+  -545,
+  -552,
   -558,
-  -563,
-  -569,
-  -574,
-  -579,
-  -584,
-  -590,
+  -564,
+  -571,
+  -577,
+  -583,
+  -589,
   -595,
-  -600,
-  -605,
-  -610,
-  -615,
-  -620,
+  -601,
+  -607,
+  -613,
+  -619,
   -625,
-  -630,
-  -635,
-  -640,
-  -645,
-  -649,
-  -654,
+  -631,
+  -636,
+  -642,
+  -647,
+  -653,
   -659,
   -664,
-  -668,
-  -673,
-  -678,
-  -682,
-  -687,
+  -669,
+  -675,
+  -681,
+  -686,
   -691,
   -696,
-  -700,
-  -705,
-  -709,
-  -714,
-  -718,
+  -702,
+  -707,
+  -712,
+  -717,
   -722,
-  -727,
-  -731,
-  -735,
-  -739,
-  -744,
+  -728,
+  -732,
+  -737,
+  -742,
   -748,
   -752,
-  -756,
-  -760,
-  -764,
-  -768,
-  -772,
+  -757,
+  -761,
+  -766,
+  -771,
   -776,
   -780,
-  -784,
-  -788,
-  -792,
-  -796,
-  -800,
+  -785,
+  -790,
+  -794,
+  -799,
   -803,
   -807,
-  -811,
-  -815,
-  -818,
-  -822,
-  -826,
+  -812,
+  -816,
+  -820,
+  -825,
   -829,
   -833,
-  -836,
-  -840,
-  -844,
-  -847,
-  -850,
+  -837,
+  -842,
+  -846,
+  -849,
   -854,
-  -857,
-  -861,
-  -864,
-  -867,
-  -871,
+  -858,
+  -862,
+  -865,
+  -870,
   -874,
   -877,
-  -881,
-  -884,
-  -887,
-  -890,
-  -893,
+  -882,
+  -885,
+  -889,
+  -892,
   -897,
   -900,
-  -903,
-  -906,
-  -909,
-  -912,
-  -915,
+  -904,
+  -907,
+  -911,
+  -914,
   -918,
   -921,
-  -924,
-  -927,
-  -930,
-  -932,
-  -935,
+  -925,
+  -928,
+  -931,
+  -934,
   -938,
   -941,
-  -944,
-  -946,
-  -949,
-  -952,
-  -955,
+  -945,
+  -947,
+  -951,
+  -954,
   -957,
   -960,
-  -963,
-  -965,
-  -968,
+  -964,
+  -966,
   -970,
-  -973,
+  -972,
   -975,
   -978,
-  -980,
-  -983,
-  -985,
-  -988,
+  -981,
+  -984,
+  -987,
   -990,
   -993,
   -995,
-  -997,
-  -1000,
-  -1002,
-  -1004,
+  -998,
+  -1001,
+  -1003,
   -1007,
   -1009,
   -1011,
+  -1015,
   -1013,
-  -1016,
-  -1009,
-  -994,
-  -981,
-  -967,
-  -953,
-  -939,
-  -926,
-  -913,
-  -899,
+  -998,
+  -982,
+  -966,
+  -949,
+  -933,
+  -918,
+  -902,
   -886,
-  -873,
-  -859,
-  -846,
-  -833,
-  -820,
-  -807,
+  -871,
+  -855,
+  -840,
+  -824,
+  -809,
   -794,
-  -782,
-  -769,
-  -756,
-  -744,
-  -731,
-  -719,
+  -780,
+  -764,
+  -750,
+  -735,
+  -721,
   -706,
-  -694,
-  -682,
-  -669,
-  -657,
-  -645,
-  -633,
-  -621,
-  -609,
-  -597,
-  -585,
-  -574,
-  -562,
-  -550,
-  -539,
-  -527,
-  -516,
-  -505,
-  -493,
-  -482,
-  -471,
-  -460,
-  -449,
-  -438,
-  -427,
-  -416,
-  -405,
+  -692,
+  -677,
+  -662,
+  -648,
+  -634,
+  -620,
+  -606,
+  -592,
+  -579,
+  -565,
+  -551,
+  -538,
+  -524,
+  -511,
+  -498,
+  -484,
+  -472,
+  -459,
+  -446,
+  -433,
+  -420,
+  -407,
   -394,
-  -383,
-  -373,
-  -362,
-  -351,
-  -341,
-  -330,
+  -381,
+  -370,
+  -356,
+  -344,
+  -332,
   -320,
-  -310,
-  -299,
-  -289,
-  -279,
-  -269,
-  -259,
+  -308,
+  -295,
+  -284,
+  -272,
+  -260,
   -249,
-  -239,
-  -229,
-  -219,
-  -209,
-  -200,
-  -190,
-  -180,
-  -171,
-  -161,
-  -151,
-  -142,
-  -133,
-  -123,
-  -114,
-  -105,
-  -96,
-  -86,
-  -77,
-  -68,
+  -237,
+  -225,
+  -213,
+  -202,
+  -191,
+  -179,
+  -169,
+  -157,
+  -146,
+  -135,
+  -124,
+  -113,
+  -103,
+  -91,
+  -80,
+  -70,
   -59,
-  -50,
-  -41,
-  -33,
-  -24,
-  -15,
-  -6
+  -49,
+  -38,
+  -29,
+  -18,
+  -8
 };
@@ -20,83 +20,71 @@
 #include "waveforms.h"
 const int16_t violin_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   7,
-  11,
+  12,
+  16,
+  20,
+  20,
   15,
-  19,
-  21,
-  19,
-  14,
   9,
   8,
-  10,
-  12,
-  16,
-  25,
-  44,
-  73,
-  111,
-  159,
-  215,
-  268,
-  319,
-  372,
-  431,
-  491,
-  554,
-  619,
-  682,
-  742,
-  800,
-  852,
-  901,
-  946,
-  981,
-  1006,
-  1021,
-  1024,
+  11,
+  14,
+  22,
+  41,
+  75,
+  121,
+  181,
+  246,
+  306,
+  368,
+  436,
+  507,
+  582,
+  658,
+  729,
+  797,
+  858,
+  915,
+  964,
+  998,
   1019,
-  1003,
-  976,
-  943,
-  906,
-  864,
-  819,
-  769,
-  712,
-  655,
-  598,
-  544,
-  490,
-  442,
-  398,
-  355,
-  316,
-  282,
-  252,
-  229,
-  215,
+  1024,
+  1017,
+  995,
+  960,
+  919,
+  871,
+  818,
+  759,
+  692,
+  625,
+  560,
+  497,
+  440,
+  389,
+  339,
+  297,
+  259,
+  231,
+  214,
   209,
-  212,
-  221,
-  238,
-  263,
-  293,
-  328,
-  369,
-  413,
-  456,
-  499,
-  538,
-  576,
-  612,
-  649,
-  684,
-  719,
-  748,
-  767,
+  215,
+  230,
+  257,
+  291,
+  332,
+  381,
+  433,
+  483,
+  531,
+  575,
+  617,
+  660,
+  701,
+  739,
+  764,
   778,
-  785,
-  789,
+  786,
   790,
   790,
   790,
@@ -104,519 +92,443 @@ const int16_t violin_0001[N_WAVEFORM_SAMPLES] PROGMEM = {
   791,
   792,
   793,
-  793,
-  796,
-  802,
-  811,
+  794,
+  800,
+  810,
   818,
   822,
   823,
-  821,
-  815,
-  805,
-  790,
-  770,
-  746,
-  717,
-  682,
-  645,
-  605,
-  560,
-  516,
-  470,
-  419,
-  368,
-  315,
-  261,
-  204,
-  151,
-  100,
-  49,
-  -4,
-  -61,
-  -121,
-  -179,
-  -235,
-  -294,
-  -351,
-  -405,
-  -453,
-  -493,
-  -525,
-  -551,
-  -572,
-  -587,
-  -599,
-  -608,
+  818,
+  808,
+  791,
+  768,
+  739,
+  702,
+  660,
+  614,
+  562,
+  511,
+  455,
+  395,
+  334,
+  271,
+  205,
+  143,
+  84,
+  23,
+  -42,
+  -112,
+  -180,
+  -246,
+  -315,
+  -380,
+  -440,
+  -488,
+  -526,
+  -556,
+  -578,
+  -594,
+  -606,
   -614,
   -619,
   -621,
-  -619,
-  -614,
-  -609,
-  -602,
+  -617,
+  -611,
+  -604,
   -596,
   -591,
-  -586,
-  -582,
-  -579,
-  -576,
-  -572,
+  -585,
+  -581,
+  -577,
+  -573,
   -565,
-  -559,
-  -555,
+  -558,
   -554,
   -554,
-  -556,
-  -559,
+  -555,
+  -558,
   -565,
-  -574,
-  -585,
-  -595,
-  -607,
-  -621,
-  -637,
-  -656,
-  -676,
-  -696,
-  -717,
-  -739,
-  -760,
-  -780,
-  -799,
-  -815,
-  -827,
-  -836,
-  -842,
-  -845,
+  -576,
+  -588,
+  -601,
+  -616,
+  -635,
+  -657,
+  -680,
+  -704,
+  -729,
+  -754,
+  -778,
+  -800,
+  -818,
+  -831,
+  -840,
+  -844,
   -845,
-  -843,
-  -837,
-  -829,
-  -815,
-  -797,
-  -776,
-  -751,
-  -724,
-  -692,
-  -654,
-  -614,
-  -572,
-  -530,
-  -487,
-  -446,
-  -405,
-  -364,
-  -325,
-  -287,
-  -249,
+  -842,
+  -835,
+  -824,
+  -804,
+  -781,
+  -752,
+  -720,
+  -681,
+  -635,
+  -587,
+  -538,
+  -488,
+  -440,
+  -392,
+  -344,
+  -300,
+  -255,
   -213,
-  -179,
-  -146,
-  -116,
-  -90,
-  -69,
-  -52,
+  -173,
+  -135,
+  -102,
+  -75,
+  -54,
   -40,
-  -33,
-  -30,
+  -32,
   -29,
-  -30,
-  -33,
+  -29,
+  -32,
   -37,
   -42,
-  -49,
-  -57,
-  -65,
-  -74,
-  -84,
-  -95,
-  -106,
-  -119,
-  -132,
-  -146,
-  -161,
-  -179,
+  -51,
+  -60,
+  -70,
+  -82,
+  -94,
+  -107,
+  -123,
+  -138,
+  -155,
+  -175,
   -198,
-  -216,
-  -232,
-  -248,
-  -263,
-  -278,
-  -292,
+  -218,
+  -237,
+  -255,
+  -273,
+  -290,
   -306,
-  -319,
-  -330,
-  -338,
-  -341,
-  -337,
-  -326,
+  -321,
+  -333,
+  -340,
+  -339,
+  -328,
   -310,
-  -292,
-  -268,
-  -237,
-  -199,
-  -161,
-  -124,
-  -85,
-  -45,
-  -2,
-  43,
-  86,
-  128,
-  171,
-  210,
-  247,
-  282,
-  316,
-  346,
-  372,
-  395,
-  413,
-  428,
-  440,
-  449,
-  454,
-  458,
+  -288,
+  -257,
+  -217,
+  -171,
+  -128,
+  -83,
+  -35,
+  16,
+  68,
+  117,
+  168,
+  214,
+  256,
+  297,
+  335,
+  367,
+  394,
+  415,
+  432,
+  445,
+  453,
+  457,
   460,
   461,
   460,
-  458,
-  455,
-  451,
-  445,
+  457,
+  453,
+  446,
   438,
-  430,
-  420,
-  412,
-  404,
-  395,
-  383,
-  370,
-  355,
-  338,
-  321,
-  306,
-  291,
-  276,
-  260,
-  244,
-  230,
-  220,
-  212,
-  205,
-  197,
+  428,
+  417,
+  408,
+  398,
+  385,
+  369,
+  351,
+  331,
+  312,
+  295,
+  277,
+  259,
+  240,
+  225,
+  215,
+  207,
+  198,
   191,
   188,
   187,
-  188,
   189,
   190,
   191,
   191,
   190,
-  188,
-  184,
-  180,
+  186,
+  181,
   178,
   176,
-  171,
-  163,
-  156,
-  150,
-  145,
-  141,
+  170,
+  160,
+  153,
+  146,
+  142,
   136,
-  132,
-  128,
-  124,
-  121,
+  131,
+  127,
+  122,
   120,
   119,
   119,
   119,
-  121,
-  125,
-  131,
-  138,
-  148,
-  159,
-  171,
-  185,
-  199,
-  213,
-  227,
-  241,
-  255,
-  269,
-  281,
-  292,
-  299,
-  305,
-  306,
+  122,
+  128,
+  136,
+  147,
+  160,
+  175,
+  191,
+  207,
+  224,
+  240,
+  257,
+  273,
+  287,
+  297,
   304,
-  296,
-  285,
-  270,
-  253,
-  232,
+  306,
+  303,
+  293,
+  278,
+  259,
+  236,
   207,
-  180,
-  151,
-  122,
-  94,
-  67,
-  43,
-  20,
-  -2,
-  -24,
-  -41,
-  -53,
-  -61,
+  175,
+  140,
+  107,
+  75,
+  46,
+  19,
+  -7,
+  -31,
+  -48,
+  -59,
   -62,
   -56,
-  -47,
-  -35,
-  -21,
-  -2,
-  19,
-  42,
-  64,
-  85,
-  107,
-  129,
-  151,
-  171,
-  188,
-  203,
-  214,
-  223,
-  228,
+  -44,
+  -30,
+  -10,
+  14,
+  40,
+  66,
+  91,
+  117,
+  143,
+  167,
+  187,
+  205,
+  217,
+  226,
   228,
   226,
   223,
-  218,
-  213,
-  207,
-  200,
-  192,
-  185,
+  217,
+  211,
+  204,
+  194,
+  186,
   178,
-  172,
-  166,
-  163,
+  171,
+  164,
   163,
   164,
   165,
   163,
-  161,
+  160,
   159,
-  158,
-  155,
-  151,
-  146,
-  138,
-  129,
-  119,
-  107,
-  95,
-  80,
-  63,
-  45,
-  28,
-  11,
-  -5,
-  -21,
-  -36,
+  157,
+  152,
+  147,
+  137,
+  127,
+  114,
+  100,
+  84,
+  64,
+  43,
+  23,
+  3,
+  -15,
+  -33,
   -49,
-  -60,
-  -69,
-  -74,
+  -62,
+  -71,
   -75,
-  -73,
-  -69,
+  -74,
+  -70,
   -63,
-  -55,
-  -45,
-  -35,
-  -26,
-  -16,
-  -6,
-  3,
-  12,
-  18,
-  21,
+  -53,
+  -41,
+  -30,
+  -19,
+  -7,
+  4,
+  14,
+  20,
   21,
-  19,
+  20,
   16,
   11,
-  5,
-  -2,
-  -11,
-  -22,
-  -32,
-  -43,
-  -53,
-  -64,
-  -75,
-  -86,
-  -97,
-  -106,
+  3,
+  -5,
+  -18,
+  -30,
+  -42,
+  -54,
+  -67,
+  -80,
+  -93,
+  -104,
   -114,
-  -120,
-  -125,
-  -129,
-  -132,
+  -121,
+  -126,
+  -131,
   -133,
   -131,
   -127,
-  -122,
-  -117,
-  -113,
-  -108,
-  -104,
-  -98,
+  -121,
+  -116,
+  -110,
+  -105,
+  -99,
   -91,
-  -82,
-  -73,
-  -66,
-  -60,
-  -55,
+  -80,
+  -70,
+  -63,
+  -56,
   -51,
   -47,
-  -42,
-  -38,
-  -34,
-  -31,
-  -29,
+  -41,
+  -36,
+  -32,
+  -30,
   -26,
   -23,
-  -19,
-  -14,
-  -10,
-  -6,
+  -18,
+  -12,
+  -7,
   -4,
   -4,
   -5,
-  -8,
   -9,
-  -8,
-  -6,
+  -9,
+  -7,
   -5,
   -6,
   -8,
-  -10,
-  -12,
-  -14,
-  -17,
-  -21,
+  -11,
+  -13,
+  -16,
+  -20,
   -27,
-  -35,
-  -45,
-  -54,
-  -64,
-  -74,
-  -83,
-  -94,
-  -109,
-  -128,
-  -146,
-  -163,
-  -177,
-  -189,
-  -198,
-  -204,
+  -37,
+  -48,
+  -59,
+  -71,
+  -82,
+  -95,
+  -113,
+  -135,
+  -156,
+  -174,
+  -188,
+  -199,
+  -205,
   -207,
-  -206,
-  -204,
+  -205,
   -203,
   -201,
   -199,
-  -196,
-  -192,
-  -188,
-  -184,
+  -195,
+  -190,
+  -185,
   -181,
   -180,
   -182,
-  -184,
-  -187,
-  -191,
-  -195,
-  -200,
+  -185,
+  -189,
+  -194,
+  -199,
   -208,
-  -219,
-  -233,
-  -250,
-  -271,
-  -294,
-  -319,
-  -347,
-  -376,
-  -407,
-  -440,
-  -473,
-  -506,
-  -538,
-  -566,
-  -590,
-  -613,
-  -636,
-  -656,
-  -674,
-  -690,
-  -700,
-  -703,
-  -700,
-  -690,
-  -674,
-  -653,
-  -628,
-  -600,
+  -221,
+  -238,
+  -260,
+  -287,
+  -315,
+  -348,
+  -382,
+  -419,
+  -458,
+  -497,
+  -535,
   -568,
-  -531,
-  -493,
-  -457,
-  -423,
+  -595,
+  -623,
+  -648,
+  -670,
+  -689,
+  -701,
+  -703,
+  -696,
+  -681,
+  -658,
+  -629,
+  -596,
+  -557,
+  -513,
+  -470,
+  -429,
   -392,
-  -358,
-  -321,
-  -290,
-  -266,
-  -248,
-  -235,
+  -352,
+  -310,
+  -277,
+  -253,
+  -237,
   -227,
   -225,
-  -225,
-  -230,
-  -241,
-  -258,
-  -280,
-  -305,
-  -331,
-  -356,
-  -377,
-  -395,
-  -411,
-  -426,
-  -438,
-  -444,
-  -444,
-  -436,
-  -418,
-  -392,
-  -365,
-  -336,
+  -226,
+  -235,
+  -252,
+  -277,
   -306,
-  -273,
-  -237,
-  -201,
-  -169,
-  -140,
-  -113,
-  -88,
-  -65,
-  -41,
-  -20,
-  -3
+  -337,
+  -365,
+  -387,
+  -407,
+  -425,
+  -439,
+  -445,
+  -442,
+  -427,
+  -398,
+  -367,
+  -333,
+  -297,
+  -257,
+  -214,
+  -175,
+  -141,
+  -109,
+  -81,
+  -53,
+  -27,
+  -6
 };